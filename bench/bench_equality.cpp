@@ -0,0 +1,104 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <memory>
+
+namespace {
+    struct BenchMessage final {
+        kstd::u32 id;
+        kstd::f64 payload;
+    };
+
+    struct OtherBenchMessage final {
+        kstd::u32 id;
+    };
+
+    // How TypeInfo::is_same used to compare, for comparison
+    auto compare_by_name(const kstd::reflect::RTTI& lhs, const kstd::reflect::RTTI& rhs) noexcept -> bool {
+        return lhs.get_element_type() == rhs.get_element_type() &&
+               lhs.get_mangled_type_name() == rhs.get_mangled_type_name();
+    }
+
+    // An equal type registered in a separate registry, as another shared library would
+    auto get_foreign_info() noexcept -> const kstd::reflect::RTTI& {
+        using namespace kstd::reflect;
+        static Registry s_registry;
+        static const RTTI& s_info = [] {
+            const auto& info = *KSTD_LOOKUP_TYPE(BenchMessage);
+            const RegistryKey key {ElementType::TYPE, {}, get_type_key_name<BenchMessage>(), {}};
+            return std::cref(s_registry.insert(
+                    key, std::make_unique<TypeInfo<BenchMessage>>(info.get_mangled_type_name(), info.get_type_name())));
+        }();
+        return s_info;
+    }
+}// namespace
+
+static void is_same_equal(benchmark::State& state) {
+    const kstd::reflect::RTTI& lhs = *KSTD_LOOKUP_TYPE(BenchMessage);
+    const kstd::reflect::RTTI& rhs = *KSTD_LOOKUP_TYPE(BenchMessage);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(lhs.is_same(rhs));
+    }
+}
+
+static void is_same_different(benchmark::State& state) {
+    const kstd::reflect::RTTI& lhs = *KSTD_LOOKUP_TYPE(BenchMessage);
+    const kstd::reflect::RTTI& rhs = *KSTD_LOOKUP_TYPE(OtherBenchMessage);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(lhs.is_same(rhs));
+    }
+}
+
+static void is_same_foreign(benchmark::State& state) {
+    const kstd::reflect::RTTI& lhs = *KSTD_LOOKUP_TYPE(BenchMessage);
+    const auto& rhs = get_foreign_info();
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(lhs.is_same(rhs));
+    }
+}
+
+static void compare_by_name_equal(benchmark::State& state) {
+    const kstd::reflect::RTTI& lhs = *KSTD_LOOKUP_TYPE(BenchMessage);
+    const kstd::reflect::RTTI& rhs = *KSTD_LOOKUP_TYPE(BenchMessage);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(compare_by_name(lhs, rhs));
+    }
+}
+
+static void compare_by_name_different(benchmark::State& state) {
+    const kstd::reflect::RTTI& lhs = *KSTD_LOOKUP_TYPE(BenchMessage);
+    const kstd::reflect::RTTI& rhs = *KSTD_LOOKUP_TYPE(OtherBenchMessage);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(compare_by_name(lhs, rhs));
+    }
+}
+
+BENCHMARK(is_same_equal);
+BENCHMARK(is_same_different);
+BENCHMARK(is_same_foreign);
+BENCHMARK(compare_by_name_equal);
+BENCHMARK(compare_by_name_different);
\ No newline at end of file
@@ -0,0 +1,115 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <vector>
+
+namespace {
+    struct Row final {
+        kstd::u64 id;
+        kstd::f32 value;
+        kstd::u32 flags;
+        kstd::f64 weight;
+        kstd::i64 timestamp;
+    };
+
+    auto make_rows(kstd::usize count) noexcept -> std::vector<Row> {
+        std::vector<Row> rows(count);
+
+        for(kstd::usize index = 0; index < count; ++index) {
+            rows[index] = {index, static_cast<kstd::f32>(index), 0, 1.0, 0};
+        }
+
+        return rows;
+    }
+}// namespace
+
+// Exports one column through a get call per row
+static void export_column_per_row(benchmark::State& state) {
+    const auto count = static_cast<kstd::usize>(state.range(0));
+    const auto rows = make_rows(count);
+    std::vector<kstd::f32> column(count);
+    const auto& info = *KSTD_LOOKUP_FIELD_T(Row, value);
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < count; ++index) {
+            column[index] = info.get(&rows[index]);
+        }
+
+        benchmark::DoNotOptimize(column.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void export_column_gather(benchmark::State& state) {
+    const auto count = static_cast<kstd::usize>(state.range(0));
+    const auto rows = make_rows(count);
+    std::vector<kstd::f32> column(count);
+    const auto& info = *KSTD_LOOKUP_FIELD_T(Row, value);
+
+    for(auto _ : state) {
+        info.gather(rows.data(), count, column.data());
+        benchmark::DoNotOptimize(column.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void import_column_per_row(benchmark::State& state) {
+    const auto count = static_cast<kstd::usize>(state.range(0));
+    auto rows = make_rows(count);
+    const std::vector<kstd::f64> column(count, 2.0);
+    const auto& info = *KSTD_LOOKUP_FIELD_T(Row, weight);
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < count; ++index) {
+            info.set(&rows[index], column[index]);
+        }
+
+        benchmark::DoNotOptimize(rows.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void import_column_scatter(benchmark::State& state) {
+    const auto count = static_cast<kstd::usize>(state.range(0));
+    auto rows = make_rows(count);
+    const std::vector<kstd::f64> column(count, 2.0);
+    const auto& info = *KSTD_LOOKUP_FIELD_T(Row, weight);
+
+    for(auto _ : state) {
+        info.scatter(rows.data(), count, column.data());
+        benchmark::DoNotOptimize(rows.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(export_column_per_row)->Range(1 << 10, 1 << 20);
+BENCHMARK(export_column_gather)->Range(1 << 10, 1 << 20);
+BENCHMARK(import_column_per_row)->Range(1 << 10, 1 << 20);
+BENCHMARK(import_column_scatter)->Range(1 << 10, 1 << 20);
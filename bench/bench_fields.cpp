@@ -0,0 +1,103 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+
+#include <vector>
+
+namespace {
+    struct Body final {
+        kstd::f32 mass {1.0F};
+        kstd::f32 velocity {0.0F};
+        kstd::u64 flags {0};
+    };
+
+    constexpr kstd::usize body_count = 1024;
+}// namespace
+
+static void field_get_direct(benchmark::State& state) {
+    const std::vector<Body> bodies(body_count);
+
+    for(auto _ : state) {
+        kstd::f32 total = 0.0F;
+
+        for(const auto& body : bodies) {
+            total += body.velocity;
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * body_count);
+}
+
+static void field_get_reflected(benchmark::State& state) {
+    const std::vector<Body> bodies(body_count);
+    const auto& field = *KSTD_LOOKUP_FIELD_T(Body, velocity);
+
+    for(auto _ : state) {
+        kstd::f32 total = 0.0F;
+
+        for(const auto& body : bodies) {
+            total += field.get(&body);
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * body_count);
+}
+
+static void field_set_direct(benchmark::State& state) {
+    std::vector<Body> bodies(body_count);
+
+    for(auto _ : state) {
+        for(auto& body : bodies) {
+            body.velocity = 2.0F;
+        }
+
+        benchmark::DoNotOptimize(bodies.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * body_count);
+}
+
+static void field_set_reflected(benchmark::State& state) {
+    std::vector<Body> bodies(body_count);
+    const auto& field = *KSTD_LOOKUP_FIELD_T(Body, velocity);
+
+    for(auto _ : state) {
+        for(auto& body : bodies) {
+            field.set(&body, 2.0F);
+        }
+
+        benchmark::DoNotOptimize(bodies.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * body_count);
+}
+
+BENCHMARK(field_get_direct);
+BENCHMARK(field_get_reflected);
+BENCHMARK(field_set_direct);
+BENCHMARK(field_set_reflected);
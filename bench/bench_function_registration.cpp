@@ -0,0 +1,79 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <utility>
+
+namespace {
+    constexpr kstd::usize function_count = 256;
+
+    // Every generated function has a signature of its own, so nothing it refers to is registered yet
+    template<kstd::usize FUNCTION, kstd::usize PARAM>
+    struct GeneratedParam final {
+        kstd::i32 value;
+    };
+
+    template<kstd::usize FUNCTION>
+    [[gnu::noinline]] auto generated_function(GeneratedParam<FUNCTION, 0> lhs, GeneratedParam<FUNCTION, 1> rhs,
+                                              GeneratedParam<FUNCTION, 2>) noexcept -> GeneratedParam<FUNCTION, 3> {
+        return {lhs.value + rhs.value};
+    }
+
+    template<kstd::usize... FUNCTIONS>
+    auto register_functions(std::index_sequence<FUNCTIONS...>) noexcept -> void {
+        (benchmark::DoNotOptimize(kstd::reflect::lookup_function(&generated_function<FUNCTIONS>, "generated_function")),
+         ...);
+    }
+
+    [[gnu::noinline]] auto add(kstd::i32 lhs, kstd::f32 rhs, void*) noexcept -> kstd::f64 {
+        return lhs + rhs;
+    }
+}// namespace
+
+// Registers a batch of functions once, which is what a program does while starting up
+static void function_registration_cold(benchmark::State& state) {
+    const auto& registry = kstd::reflect::get_registry();
+    const auto entry_count = registry.get_size();
+    const auto byte_size = registry.get_arena().get_byte_size() + registry.get_table_byte_size();
+
+    for(auto _ : state) {
+        register_functions(std::make_index_sequence<function_count> {});
+    }
+
+    state.counters["entries"] = static_cast<double>(registry.get_size() - entry_count);
+    state.counters["bytes"] =
+            static_cast<double>(registry.get_arena().get_byte_size() + registry.get_table_byte_size() - byte_size);
+    state.SetItemsProcessed(static_cast<kstd::i64>(function_count));
+}
+
+static void function_info_construct(benchmark::State& state) {
+    using Info = kstd::reflect::FunctionInfo<kstd::f64, kstd::i32, kstd::f32, void*>;
+
+    for(auto _ : state) {
+        Info info {"add", "double(int, float, void*)", "add", &add};
+        benchmark::DoNotOptimize(info);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(function_registration_cold)->Iterations(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(function_info_construct);
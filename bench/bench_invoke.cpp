@@ -0,0 +1,145 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+    [[gnu::noinline]] auto add(kstd::i32 lhs, kstd::i32 rhs) noexcept -> kstd::i32 {
+        return lhs + rhs;
+    }
+
+    struct Accumulator final {
+        kstd::i64 total = 0;
+
+        [[gnu::noinline]] auto add(kstd::i64 value) noexcept -> kstd::i64 {
+            return total += value;
+        }
+    };
+
+    struct Handler final {
+        const kstd::reflect::RTTI* function;
+        kstd::reflect::Invoker invoker;
+    };
+
+    // What an RPC layer would build once to dispatch calls by name
+    auto get_handlers() noexcept -> const std::unordered_map<std::string_view, Handler>& {
+        static const std::unordered_map<std::string_view, Handler> s_handlers = [] {
+            std::unordered_map<std::string_view, Handler> handlers;
+            const auto& add_info = *KSTD_LOOKUP_FUN(add);
+            const auto& accumulate_info = *KSTD_LOOKUP_FUN_M(Accumulator::add);
+            handlers.emplace("add", Handler {&add_info, add_info.get_invoker()});
+            handlers.emplace("Accumulator::add", Handler {&accumulate_info, accumulate_info.get_invoker()});
+            return handlers;
+        }();
+        return s_handlers;
+    }
+}// namespace
+
+static void invoke_direct(benchmark::State& state) {
+    kstd::i32 lhs = 1;
+    kstd::i32 rhs = 2;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(add(lhs, rhs));
+    }
+}
+
+static void invoke_typed(benchmark::State& state) {
+    const auto& info = *KSTD_LOOKUP_FUN(add);
+    kstd::i32 lhs = 1;
+    kstd::i32 rhs = 2;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(info.invoke(lhs, rhs));
+    }
+}
+
+static void invoke_erased(benchmark::State& state) {
+    const auto& info = *KSTD_LOOKUP_FUN(add);
+    kstd::i32 lhs = 1;
+    kstd::i32 rhs = 2;
+    void* const args[] {&lhs, &rhs};
+    kstd::i32 result = 0;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        info.invoke_erased(&result, args);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void invoke_by_name(benchmark::State& state) {
+    const auto& handlers = get_handlers();
+    kstd::i32 lhs = 1;
+    kstd::i32 rhs = 2;
+    void* const args[] {&lhs, &rhs};
+    kstd::i32 result = 0;
+
+    for(auto _ : state) {
+        const auto& handler = handlers.find("add")->second;
+        handler.invoker(*handler.function, &result, args);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void invoke_member_direct(benchmark::State& state) {
+    Accumulator accumulator {};
+    kstd::i64 value = 1;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(accumulator.add(value));
+    }
+}
+
+static void invoke_member_typed(benchmark::State& state) {
+    const auto& info = *KSTD_LOOKUP_FUN_M(Accumulator::add);
+    Accumulator accumulator {};
+    kstd::i64 value = 1;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(info.invoke(accumulator, value));
+    }
+}
+
+static void invoke_member_erased(benchmark::State& state) {
+    const auto& info = *KSTD_LOOKUP_FUN_M(Accumulator::add);
+    Accumulator accumulator {};
+    kstd::i64 value = 1;
+    void* const args[] {&accumulator, &value};
+    kstd::i64 result = 0;
+
+    for(auto _ : state) {
+        info.invoke_erased(&result, args);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(invoke_direct);
+BENCHMARK(invoke_typed);
+BENCHMARK(invoke_erased);
+BENCHMARK(invoke_by_name);
+BENCHMARK(invoke_member_direct);
+BENCHMARK(invoke_member_typed);
+BENCHMARK(invoke_member_erased);
\ No newline at end of file
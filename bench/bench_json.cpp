@@ -0,0 +1,375 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/json.hpp>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    struct Location final {
+        std::string city;
+        kstd::f64 latitude;
+        kstd::f64 longitude;
+    };
+
+    struct Record final {
+        kstd::u64 id;
+        std::string name;
+        std::string email;
+        kstd::i32 age;
+        kstd::f64 balance;
+        bool active;
+        kstd::u32 visits;
+        Location location;
+    };
+
+    constexpr kstd::usize record_count = 10000;
+
+    auto reflect_record() noexcept -> void {
+        (void) KSTD_REFLECT_STRUCT(Location, city, latitude, longitude);
+        (void) KSTD_REFLECT_STRUCT(Record, id, name, email, age, balance, active, visits, location);
+    }
+
+    auto make_record(kstd::usize index) noexcept -> Record {
+        return {index,
+                "User " + std::to_string(index),
+                "user" + std::to_string(index) + "@example.com",
+                static_cast<kstd::i32>(18 + index % 60),
+                static_cast<kstd::f64>(index) * 1.25,
+                index % 3 != 0,
+                static_cast<kstd::u32>(index * 7),
+                {"City " + std::to_string(index % 100), 48.1 + static_cast<kstd::f64>(index % 10),
+                 11.5 - static_cast<kstd::f64>(index % 10)}};
+    }
+
+    // Newline separated records, each with a few keys the binding does not know
+    auto make_corpus() noexcept -> std::string {
+        reflect_record();
+        std::string corpus;
+
+        for(kstd::usize index = 0; index < record_count; ++index) {
+            std::string record;
+            (void) kstd::reflect::encode_json(make_record(index), record);
+            record.pop_back();
+            record += R"(,"tags":["alpha","beta",{"weight":3}],"notes":"some \"quoted\" text"})";
+            corpus += record;
+            corpus += '\n';
+        }
+
+        return corpus;
+    }
+
+    // A minimal DOM, standing in for a general purpose JSON library
+    struct JsonValue final {
+        enum class Kind {
+            NUL,
+            BOOL,
+            NUMBER,
+            STRING,
+            ARRAY,
+            OBJECT
+        };
+
+        Kind kind {Kind::NUL};
+        bool boolean {false};
+        kstd::f64 number {0.0};
+        std::string string;
+        std::vector<JsonValue> array;
+        std::vector<std::pair<std::string, JsonValue>> object;
+
+        [[nodiscard]] auto operator[](std::string_view key) const noexcept -> const JsonValue& {
+            static const JsonValue null_value {};
+
+            for(const auto& [name, value] : object) {
+                if(name == key) {
+                    return value;
+                }
+            }
+
+            return null_value;
+        }
+    };
+
+    struct DomParser final {
+        const char* current;
+
+        auto skip_whitespace() noexcept -> void {
+            while(*current == ' ' || *current == '\n' || *current == '\r' || *current == '\t') {
+                ++current;// NOLINT
+            }
+        }
+
+        auto parse_string() noexcept -> std::string {
+            std::string result;
+            ++current;// NOLINT
+
+            while(*current != '"') {
+                if(*current == '\\') {
+                    ++current;// NOLINT
+                    result.push_back(*current == 'n' ? '\n' : *current == 't' ? '\t' : *current);
+                }
+                else {
+                    result.push_back(*current);
+                }
+
+                ++current;// NOLINT
+            }
+
+            ++current;// NOLINT
+            return result;
+        }
+
+        auto parse() noexcept -> JsonValue {
+            skip_whitespace();
+            JsonValue value;
+
+            switch(*current) {
+                case '{':
+                    value.kind = JsonValue::Kind::OBJECT;
+                    ++current;// NOLINT
+                    skip_whitespace();
+
+                    while(*current != '}') {
+                        skip_whitespace();
+                        auto key = parse_string();
+                        skip_whitespace();
+                        ++current;// NOLINT - ':'
+                        value.object.emplace_back(std::move(key), parse());
+                        skip_whitespace();
+
+                        if(*current == ',') {
+                            ++current;// NOLINT
+                        }
+                    }
+
+                    ++current;// NOLINT
+                    break;
+                case '[':
+                    value.kind = JsonValue::Kind::ARRAY;
+                    ++current;// NOLINT
+                    skip_whitespace();
+
+                    while(*current != ']') {
+                        value.array.push_back(parse());
+                        skip_whitespace();
+
+                        if(*current == ',') {
+                            ++current;// NOLINT
+                        }
+                    }
+
+                    ++current;// NOLINT
+                    break;
+                case '"':
+                    value.kind = JsonValue::Kind::STRING;
+                    value.string = parse_string();
+                    break;
+                case 't':
+                case 'f':
+                    value.kind = JsonValue::Kind::BOOL;
+                    value.boolean = *current == 't';
+                    current += value.boolean ? 4 : 5;// NOLINT
+                    break;
+                case 'n': current += 4; break;// NOLINT
+                default: {
+                    char* end = nullptr;
+                    value.kind = JsonValue::Kind::NUMBER;
+                    value.number = std::strtod(current, &end);
+                    current = end;
+                    break;
+                }
+            }
+
+            return value;
+        }
+    };
+
+    auto bind_record(const JsonValue& value) noexcept -> Record {
+        Record record {};
+        record.id = static_cast<kstd::u64>(value["id"].number);
+        record.name = value["name"].string;
+        record.email = value["email"].string;
+        record.age = static_cast<kstd::i32>(value["age"].number);
+        record.balance = value["balance"].number;
+        record.active = value["active"].boolean;
+        record.visits = static_cast<kstd::u32>(value["visits"].number);
+        const auto& location = value["location"];
+        record.location.city = location["city"].string;
+        record.location.latitude = location["latitude"].number;
+        record.location.longitude = location["longitude"].number;
+        return record;
+    }
+
+    auto make_number(kstd::f64 number) noexcept -> JsonValue {
+        JsonValue value;
+        value.kind = JsonValue::Kind::NUMBER;
+        value.number = number;
+        return value;
+    }
+
+    auto make_string(const std::string& string) noexcept -> JsonValue {
+        JsonValue value;
+        value.kind = JsonValue::Kind::STRING;
+        value.string = string;
+        return value;
+    }
+
+    auto unbind_record(const Record& record) noexcept -> JsonValue {
+        JsonValue location;
+        location.kind = JsonValue::Kind::OBJECT;
+        location.object.emplace_back("city", make_string(record.location.city));
+        location.object.emplace_back("latitude", make_number(record.location.latitude));
+        location.object.emplace_back("longitude", make_number(record.location.longitude));
+
+        JsonValue active;
+        active.kind = JsonValue::Kind::BOOL;
+        active.boolean = record.active;
+
+        JsonValue value;
+        value.kind = JsonValue::Kind::OBJECT;
+        value.object.emplace_back("id", make_number(static_cast<kstd::f64>(record.id)));
+        value.object.emplace_back("name", make_string(record.name));
+        value.object.emplace_back("email", make_string(record.email));
+        value.object.emplace_back("age", make_number(record.age));
+        value.object.emplace_back("balance", make_number(record.balance));
+        value.object.emplace_back("active", std::move(active));
+        value.object.emplace_back("visits", make_number(record.visits));
+        value.object.emplace_back("location", std::move(location));
+        return value;
+    }
+
+    auto write_dom(const JsonValue& value, std::string& out) noexcept -> void {
+        switch(value.kind) {
+            case JsonValue::Kind::NUL: out += "null"; break;
+            case JsonValue::Kind::BOOL: out += value.boolean ? "true" : "false"; break;
+            case JsonValue::Kind::NUMBER: out += std::to_string(value.number); break;
+            case JsonValue::Kind::STRING: out += '"' + value.string + '"'; break;
+            case JsonValue::Kind::ARRAY:
+                out += '[';
+
+                for(const auto& element : value.array) {
+                    write_dom(element, out);
+                    out += ',';
+                }
+
+                out += ']';
+                break;
+            case JsonValue::Kind::OBJECT:
+                out += '{';
+
+                for(const auto& [name, element] : value.object) {
+                    out += '"' + name + "\":";
+                    write_dom(element, out);
+                    out += ',';
+                }
+
+                out += '}';
+                break;
+        }
+    }
+}// namespace
+
+static void decode_json_reflected(benchmark::State& state) {
+    const auto corpus = make_corpus();
+    Record record {};
+
+    for(auto _ : state) {
+        std::string_view remaining {corpus};
+
+        while(!remaining.empty()) {
+            const auto result = kstd::reflect::decode_json(remaining, record);
+            remaining.remove_prefix(*result + 1);
+            benchmark::DoNotOptimize(record);
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<kstd::i64>(state.iterations() * corpus.size()));
+}
+
+static void decode_json_dom(benchmark::State& state) {
+    const auto corpus = make_corpus();
+
+    for(auto _ : state) {
+        DomParser parser {corpus.data()};
+
+        for(kstd::usize index = 0; index < record_count; ++index) {
+            auto record = bind_record(parser.parse());
+            benchmark::DoNotOptimize(record);
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<kstd::i64>(state.iterations() * corpus.size()));
+}
+
+static void encode_json_reflected(benchmark::State& state) {
+    reflect_record();
+    std::vector<Record> records;
+
+    for(kstd::usize index = 0; index < record_count; ++index) {
+        records.push_back(make_record(index));
+    }
+
+    std::string buffer;
+
+    for(auto _ : state) {
+        buffer.clear();
+
+        for(const auto& record : records) {
+            (void) kstd::reflect::encode_json(record, buffer);
+            buffer += '\n';
+        }
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(static_cast<kstd::i64>(state.iterations() * buffer.size()));
+}
+
+static void encode_json_dom(benchmark::State& state) {
+    std::vector<Record> records;
+
+    for(kstd::usize index = 0; index < record_count; ++index) {
+        records.push_back(make_record(index));
+    }
+
+    kstd::usize size = 0;
+
+    for(auto _ : state) {
+        std::string buffer;
+
+        for(const auto& record : records) {
+            write_dom(unbind_record(record), buffer);
+            buffer += '\n';
+        }
+
+        size = buffer.size();
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(static_cast<kstd::i64>(state.iterations() * size));
+}
+
+BENCHMARK(decode_json_reflected)->Unit(benchmark::kMillisecond);
+BENCHMARK(decode_json_dom)->Unit(benchmark::kMillisecond);
+BENCHMARK(encode_json_reflected)->Unit(benchmark::kMillisecond);
+BENCHMARK(encode_json_dom)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,230 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    struct PlainRecord final {
+        kstd::i32 value1;
+        kstd::u32 value2;
+        kstd::u64 value3;
+        kstd::i64 value4;
+        kstd::u16 value5;
+        kstd::u16 value6;
+        kstd::u32 value7;
+        kstd::u64 value8;
+    };
+
+    struct MixedRecord final {
+        kstd::i32 id;
+        kstd::u32 flags;
+        std::string name;
+        kstd::u64 timestamp;
+        kstd::i64 sequence;
+    };
+
+    auto get_plain_info() noexcept -> const kstd::reflect::TypeInfo<PlainRecord>& {
+        (void) KSTD_LOOKUP_FIELD_T(PlainRecord, value1);
+        (void) KSTD_LOOKUP_FIELD_T(PlainRecord, value2);
+        (void) KSTD_LOOKUP_FIELD_T(PlainRecord, value3);
+        (void) KSTD_LOOKUP_FIELD_T(PlainRecord, value4);
+        (void) KSTD_LOOKUP_FIELD_T(PlainRecord, value5);
+        (void) KSTD_LOOKUP_FIELD_T(PlainRecord, value6);
+        (void) KSTD_LOOKUP_FIELD_T(PlainRecord, value7);
+        (void) KSTD_LOOKUP_FIELD_T(PlainRecord, value8);
+        return *KSTD_LOOKUP_TYPE(PlainRecord);
+    }
+
+    auto get_mixed_info() noexcept -> const kstd::reflect::TypeInfo<MixedRecord>& {
+        (void) KSTD_LOOKUP_FIELD_T(MixedRecord, id);
+        (void) KSTD_LOOKUP_FIELD_T(MixedRecord, flags);
+        (void) KSTD_LOOKUP_FIELD_T(MixedRecord, name);
+        (void) KSTD_LOOKUP_FIELD_T(MixedRecord, timestamp);
+        (void) KSTD_LOOKUP_FIELD_T(MixedRecord, sequence);
+        return *KSTD_LOOKUP_TYPE(MixedRecord);
+    }
+
+    // Copies every field through its own function, as a table without merged spans would
+    template<typename T>
+    auto copy_per_field(const kstd::reflect::TypeLayout& layout, T& destination, const T& source) noexcept -> void {
+        auto* destination_bytes = reinterpret_cast<kstd::u8*>(&destination);  // NOLINT
+        const auto* source_bytes = reinterpret_cast<const kstd::u8*>(&source);// NOLINT
+
+        for(const auto& field : layout.get_fields()) {
+            field.copy(destination_bytes + field.offset, source_bytes + field.offset);// NOLINT
+        }
+    }
+
+    template<typename T>
+    auto make_records() noexcept -> std::vector<T> {
+        std::vector<T> records(1024);
+
+        for(kstd::usize index = 0; index < records.size(); ++index) {
+            if constexpr(std::is_same_v<T, MixedRecord>) {
+                records[index].name = "record name which does not fit into the small buffer";
+            }
+            records[index].timestamp = index;
+        }
+
+        return records;
+    }
+}// namespace
+
+static void plain_copy_direct(benchmark::State& state) {
+    const auto source = std::vector<PlainRecord>(1024);
+    auto destination = std::vector<PlainRecord>(1024);
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < source.size(); ++index) {
+            destination[index] = source[index];
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+}
+
+static void plain_copy_layout(benchmark::State& state) {
+    const auto& info = get_plain_info();
+    const auto source = std::vector<PlainRecord>(1024);
+    auto destination = std::vector<PlainRecord>(1024);
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < source.size(); ++index) {
+            (void) info.copy(destination[index], source[index]);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+}
+
+static void plain_copy_per_field(benchmark::State& state) {
+    const auto& layout = get_plain_info().get_layout();
+    const auto source = std::vector<PlainRecord>(1024);
+    auto destination = std::vector<PlainRecord>(1024);
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < source.size(); ++index) {
+            copy_per_field(layout, destination[index], source[index]);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+}
+
+static void mixed_copy_direct(benchmark::State& state) {
+    const auto source = make_records<MixedRecord>();
+    auto destination = make_records<MixedRecord>();
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < source.size(); ++index) {
+            destination[index] = source[index];
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+}
+
+static void mixed_copy_layout(benchmark::State& state) {
+    const auto& info = get_mixed_info();
+    const auto source = make_records<MixedRecord>();
+    auto destination = make_records<MixedRecord>();
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < source.size(); ++index) {
+            (void) info.copy(destination[index], source[index]);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+}
+
+static void mixed_copy_per_field(benchmark::State& state) {
+    const auto& layout = get_mixed_info().get_layout();
+    const auto source = make_records<MixedRecord>();
+    auto destination = make_records<MixedRecord>();
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < source.size(); ++index) {
+            copy_per_field(layout, destination[index], source[index]);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+}
+
+static void plain_equals_layout(benchmark::State& state) {
+    const auto& info = get_plain_info();
+    const auto lhs = std::vector<PlainRecord>(1024);
+    const auto rhs = std::vector<PlainRecord>(1024);
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < lhs.size(); ++index) {
+            benchmark::DoNotOptimize(info.equals(lhs[index], rhs[index]));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lhs.size()));
+}
+
+static void plain_hash_layout(benchmark::State& state) {
+    const auto& info = get_plain_info();
+    const auto records = std::vector<PlainRecord>(1024);
+
+    for(auto _ : state) {
+        for(const auto& record : records) {
+            benchmark::DoNotOptimize(info.hash(record));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+
+static void mixed_equals_layout(benchmark::State& state) {
+    const auto& info = get_mixed_info();
+    const auto lhs = make_records<MixedRecord>();
+    const auto rhs = make_records<MixedRecord>();
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < lhs.size(); ++index) {
+            benchmark::DoNotOptimize(info.equals(lhs[index], rhs[index]));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lhs.size()));
+}
+
+BENCHMARK(plain_copy_direct);
+BENCHMARK(plain_copy_layout);
+BENCHMARK(plain_copy_per_field);
+BENCHMARK(mixed_copy_direct);
+BENCHMARK(mixed_copy_layout);
+BENCHMARK(mixed_copy_per_field);
+BENCHMARK(plain_equals_layout);
+BENCHMARK(plain_hash_layout);
+BENCHMARK(mixed_equals_layout);
\ No newline at end of file
@@ -0,0 +1,133 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <utility>
+
+namespace {
+    constexpr kstd::usize cold_type_count = 256;
+
+    template<kstd::usize INDEX, kstd::usize SET>
+    struct ColdType final {
+        kstd::u64 value;
+    };
+
+    struct WarmType final {
+        kstd::u64 value;
+
+        [[nodiscard]] auto get_value() const noexcept -> kstd::u64 {
+            return value;
+        }
+    };
+
+    auto warm_function(kstd::u64 value) noexcept -> kstd::u64 {
+        return value + 1;
+    }
+
+    template<kstd::usize SET, kstd::usize... INDICES>
+    auto lookup_cold_cached(std::index_sequence<INDICES...>) noexcept -> void {
+        (benchmark::DoNotOptimize(kstd::reflect::lookup<ColdType<INDICES, SET>>()), ...);
+    }
+
+    // Bypasses the per-type slot, which is how lookup<T>() used to resolve every call
+    template<kstd::usize SET, kstd::usize... INDICES>
+    auto lookup_cold_uncached(std::index_sequence<INDICES...>) noexcept -> void {
+        using namespace kstd::reflect;
+        (benchmark::DoNotOptimize(detail::lookup_default<ColdType<INDICES, SET>, TypeInfo<ColdType<INDICES, SET>>>()),
+         ...);
+    }
+}// namespace
+
+static void lookup_warm(benchmark::State& state) {
+    (void) kstd::reflect::lookup<WarmType>();
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(kstd::reflect::lookup<WarmType>());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void lookup_warm_uncached(benchmark::State& state) {
+    using namespace kstd::reflect;
+    (void) lookup<WarmType>();
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(detail::lookup_default<WarmType, TypeInfo<WarmType>>());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void lookup_field_warm(benchmark::State& state) {
+    (void) KSTD_LOOKUP_FIELD_T(WarmType, value);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(KSTD_LOOKUP_FIELD_T(WarmType, value));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void lookup_function_warm(benchmark::State& state) {
+    (void) KSTD_LOOKUP_FUN(warm_function);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(KSTD_LOOKUP_FUN(warm_function));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void lookup_member_function_warm(benchmark::State& state) {
+    (void) KSTD_LOOKUP_FUN_M(WarmType::get_value);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(KSTD_LOOKUP_FUN_M(WarmType::get_value));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Every type can only be cold once per process, so both cold benchmarks run a single iteration over distinct types
+static void lookup_cold(benchmark::State& state) {
+    for(auto _ : state) {
+        lookup_cold_cached<0>(std::make_index_sequence<cold_type_count>());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(cold_type_count));
+}
+
+static void lookup_cold_uncached(benchmark::State& state) {
+    for(auto _ : state) {
+        lookup_cold_uncached<1>(std::make_index_sequence<cold_type_count>());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(cold_type_count));
+}
+
+BENCHMARK(lookup_warm);
+BENCHMARK(lookup_warm_uncached);
+BENCHMARK(lookup_field_warm);
+BENCHMARK(lookup_function_warm);
+BENCHMARK(lookup_member_function_warm);
+BENCHMARK(lookup_cold)->Iterations(1);
+BENCHMARK(lookup_cold_uncached)->Iterations(1);
\ No newline at end of file
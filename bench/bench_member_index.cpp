@@ -0,0 +1,87 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+#include <string_view>
+
+namespace {
+    struct Settings final {
+        kstd::u32 width;
+        kstd::u32 height;
+        kstd::u32 refresh_rate;
+        kstd::f32 gamma;
+        kstd::f32 brightness;
+        kstd::f32 contrast;
+        bool fullscreen;
+        bool vsync;
+        std::string title;
+        std::string renderer;
+        kstd::u64 seed;
+        kstd::i32 volume;
+    };
+
+    KSTD_STATIC_REFLECT_STRUCT(Settings, width, height, refresh_rate, gamma, brightness, contrast, fullscreen, vsync,
+                               title, renderer, seed, volume)
+
+    constexpr std::string_view names[] = {"width",      "height",   "refresh_rate", "gamma",
+                                          "brightness", "contrast", "fullscreen",   "vsync",
+                                          "title",      "renderer", "seed",         "volume"};
+}// namespace
+
+// What binders had to do before, scanning the layout for a matching name
+static void find_field_linear(benchmark::State& state) {
+    const auto& type = *kstd::reflect::reflect_struct<Settings>();
+    const auto& fields = type.get_fields();
+
+    for(auto _ : state) {
+        for(const auto name : names) {
+            for(const auto& field : fields) {
+                if(field.name == name) {
+                    benchmark::DoNotOptimize(type.get_field(field));
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void find_field_indexed(benchmark::State& state) {
+    const auto& type = *kstd::reflect::reflect_struct<Settings>();
+
+    for(auto _ : state) {
+        for(const auto name : names) {
+            benchmark::DoNotOptimize(type.find_field(name));
+        }
+    }
+}
+
+static void find_field_static(benchmark::State& state) {
+    for(auto _ : state) {
+        for(const auto name : names) {
+            benchmark::DoNotOptimize(kstd::reflect::static_type_info<Settings>.find_field(name));
+        }
+    }
+}
+
+BENCHMARK(find_field_linear);
+BENCHMARK(find_field_indexed);
+BENCHMARK(find_field_static);
@@ -0,0 +1,107 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <memory>
+#include <string>
+
+namespace {
+    struct Plugin final {
+        std::string name;
+        kstd::u64 id {0};
+        kstd::f64 weight {1.0};
+    };
+
+    auto get_plugin_type() noexcept -> const kstd::reflect::RTTI& {
+        using namespace kstd::reflect;
+        (void) KSTD_LOOKUP_TYPE(Plugin);
+        return *get_registry().find({ElementType::TYPE, {}, get_type_key_name<Plugin>(), {}});
+    }
+}// namespace
+
+static void make_unique_heap(benchmark::State& state) {
+    for(auto _ : state) {
+        auto plugin = std::make_unique<Plugin>();
+        benchmark::DoNotOptimize(plugin.get());
+    }
+}
+
+static void make_unique_by_rtti(benchmark::State& state) {
+    const auto& type = get_plugin_type();
+
+    for(auto _ : state) {
+        auto plugin = kstd::reflect::make_unique(type);
+        benchmark::DoNotOptimize(plugin->get());
+    }
+}
+
+static void make_shared_heap(benchmark::State& state) {
+    for(auto _ : state) {
+        auto plugin = std::make_shared<Plugin>();
+        benchmark::DoNotOptimize(plugin.get());
+    }
+}
+
+static void make_shared_by_rtti(benchmark::State& state) {
+    const auto& type = get_plugin_type();
+
+    for(auto _ : state) {
+        auto plugin = kstd::reflect::make_shared(type);
+        benchmark::DoNotOptimize(plugin->get());
+    }
+}
+
+static void make_shared_typed(benchmark::State& state) {
+    const auto& type = *KSTD_LOOKUP_TYPE(Plugin);
+
+    for(auto _ : state) {
+        auto plugin = kstd::reflect::make_shared(type);
+        benchmark::DoNotOptimize(plugin.get());
+    }
+}
+
+BENCHMARK(make_unique_heap);
+BENCHMARK(make_unique_by_rtti);
+BENCHMARK(make_shared_heap);
+BENCHMARK(make_shared_by_rtti);
+BENCHMARK(make_shared_typed);
+
+static void make_unique_typed(benchmark::State& state) {
+    const auto& type = *KSTD_LOOKUP_TYPE(Plugin);
+
+    for(auto _ : state) {
+        auto plugin = kstd::reflect::make_unique(type);
+        benchmark::DoNotOptimize(plugin.get());
+    }
+}
+
+BENCHMARK(make_unique_typed);
+
+static void make_pooled_typed(benchmark::State& state) {
+    const auto& type = *KSTD_LOOKUP_TYPE(Plugin);
+
+    for(auto _ : state) {
+        auto plugin = kstd::reflect::make_pooled(type);
+        benchmark::DoNotOptimize(plugin.get());
+    }
+}
+
+BENCHMARK(make_pooled_typed);
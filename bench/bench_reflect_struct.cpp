@@ -0,0 +1,100 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <kstd/reflect/reflection.hpp>
+#include <utility>
+
+namespace {
+    // Registration happens once per type, so every benchmark registers its own set of types
+    constexpr kstd::usize type_count = 64;
+
+    template<kstd::usize N, typename TAG>
+    struct Record final {
+        kstd::i32 value1;
+        kstd::f32 value2;
+        kstd::u64 value3;
+        kstd::i16 value4;
+        kstd::f64 value5;
+        kstd::u32 value6;
+        kstd::i64 value7;
+        kstd::u8 value8;
+    };
+
+    struct LookupTag final {};
+    struct StructTag final {};
+
+    template<kstd::usize N>
+    auto register_by_lookup() noexcept -> void {
+        using Type = Record<N, LookupTag>;
+        (void) KSTD_LOOKUP_FIELD_T(Type, value1);
+        (void) KSTD_LOOKUP_FIELD_T(Type, value2);
+        (void) KSTD_LOOKUP_FIELD_T(Type, value3);
+        (void) KSTD_LOOKUP_FIELD_T(Type, value4);
+        (void) KSTD_LOOKUP_FIELD_T(Type, value5);
+        (void) KSTD_LOOKUP_FIELD_T(Type, value6);
+        (void) KSTD_LOOKUP_FIELD_T(Type, value7);
+        (void) KSTD_LOOKUP_FIELD_T(Type, value8);
+    }
+
+    template<kstd::usize N>
+    auto register_by_struct() noexcept -> void {
+        using Type = Record<N, StructTag>;
+        (void) KSTD_REFLECT_STRUCT(Type, value1, value2, value3, value4, value5, value6, value7, value8);
+    }
+
+    template<kstd::usize... INDICES>
+    auto register_all_by_lookup(std::index_sequence<INDICES...>) noexcept -> void {
+        (register_by_lookup<INDICES>(), ...);
+    }
+
+    template<kstd::usize... INDICES>
+    auto register_all_by_struct(std::index_sequence<INDICES...>) noexcept -> void {
+        (register_by_struct<INDICES>(), ...);
+    }
+
+    template<typename F>
+    auto measure_once(benchmark::State& state, F&& function) -> void {
+        for(auto _ : state) {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const auto end = std::chrono::steady_clock::now();
+            state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(type_count));
+    }
+}// namespace
+
+static void register_types_by_lookup(benchmark::State& state) {
+    measure_once(state, [] {
+        register_all_by_lookup(std::make_index_sequence<type_count> {});
+    });
+}
+
+static void register_types_by_struct(benchmark::State& state) {
+    measure_once(state, [] {
+        register_all_by_struct(std::make_index_sequence<type_count> {});
+    });
+}
+
+BENCHMARK(register_types_by_lookup)->Iterations(1)->UseManualTime();
+BENCHMARK(register_types_by_struct)->Iterations(1)->UseManualTime();
\ No newline at end of file
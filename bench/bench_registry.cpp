@@ -0,0 +1,168 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <kstd/reflect/reflection.hpp>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    constexpr kstd::usize key_count = 1024;
+
+    struct BenchStruct final {
+        kstd::i32 value1;
+        kstd::f32 value2;
+    };
+
+    auto get_names() noexcept -> const std::vector<std::string>& {
+        static const auto s_names = [] {
+            std::vector<std::string> names;
+            names.reserve(key_count);
+
+            for(kstd::usize index = 0; index < key_count; ++index) {
+                names.push_back(fmt::format("key_{}", index));
+            }
+
+            return names;
+        }();
+        return s_names;
+    }
+
+    auto get_keys() noexcept -> const std::vector<kstd::reflect::RegistryKey>& {
+        static const auto s_keys = [] {
+            std::vector<kstd::reflect::RegistryKey> keys;
+            keys.reserve(key_count);
+
+            for(const auto& name : get_names()) {
+                keys.push_back({kstd::reflect::ElementType::TYPE, {}, name, {}});
+            }
+
+            return keys;
+        }();
+        return s_keys;
+    }
+
+    auto get_registry() noexcept -> kstd::reflect::Registry& {
+        static auto s_registry = [] {
+            auto registry = std::make_unique<kstd::reflect::Registry>();
+
+            for(const auto& key : get_keys()) {
+                registry->insert(key, std::make_unique<kstd::reflect::TypeInfo<kstd::i32>>(key.name, key.name));
+            }
+
+            return registry;
+        }();
+        return *s_registry;
+    }
+
+    // Baseline: the previous unordered_map guarded by a global mutex
+    struct LockedMap final {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::unique_ptr<kstd::reflect::RTTI>> types;
+    };
+
+    auto get_locked_map() noexcept -> LockedMap& {
+        static auto s_map = [] {
+            auto map = std::make_unique<LockedMap>();
+
+            for(const auto& name : get_names()) {
+                map->types[name] = std::make_unique<kstd::reflect::TypeInfo<kstd::i32>>(name, name);
+            }
+
+            return map;
+        }();
+        return *s_map;
+    }
+}// namespace
+
+static void registry_find(benchmark::State& state) {
+    const auto& keys = get_keys();
+    const auto& registry = get_registry();
+    kstd::usize index = static_cast<kstd::usize>(state.thread_index()) * 31;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(registry.find(keys[index++ % key_count]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void locked_map_find(benchmark::State& state) {
+    const auto& keys = get_names();
+    auto& map = get_locked_map();
+    kstd::usize index = static_cast<kstd::usize>(state.thread_index()) * 31;
+
+    for(auto _ : state) {
+        std::lock_guard<std::mutex> lock(map.mutex);
+        benchmark::DoNotOptimize(map.types.find(keys[index++ % key_count]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void registry_lookup_type(benchmark::State& state) {
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(KSTD_LOOKUP_TYPE(BenchStruct));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void registry_lookup_field(benchmark::State& state) {
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(KSTD_LOOKUP_FIELD_T(BenchStruct, value2));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(registry_find)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(locked_map_find)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(registry_lookup_type)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(registry_lookup_field)->ThreadRange(1, 64)->UseRealTime();
+
+// Fills an empty registry with the given number of entries, which includes every resize of the table
+static void registry_growth(benchmark::State& state) {
+    const auto count = static_cast<kstd::usize>(state.range(0));
+    std::vector<std::string> names;
+    names.reserve(count);
+
+    for(kstd::usize index = 0; index < count; ++index) {
+        names.push_back(fmt::format("growth_key_{}", index));
+    }
+
+    for(auto _ : state) {
+        kstd::reflect::Registry registry;
+
+        for(const auto& name : names) {
+            const kstd::reflect::RegistryKey key {kstd::reflect::ElementType::TYPE, {}, name, {}};
+            registry.insert(key, registry.create<kstd::reflect::TypeInfo<kstd::i32>>(name, name));
+        }
+
+        benchmark::DoNotOptimize(registry.get_size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(registry_growth)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,97 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <kstd/reflect/reflection.hpp>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr auto snapshot_build_id = "bench_registry_snapshot";
+
+    auto get_names(kstd::usize count) noexcept -> std::vector<std::string> {
+        std::vector<std::string> names;
+        names.reserve(count);
+
+        for(kstd::usize index = 0; index < count; ++index) {
+            names.push_back(fmt::format("startup_field_{}", index));
+        }
+
+        return names;
+    }
+
+    // Registers one field per name, like the lookups of a program starting up
+    auto register_fields(kstd::reflect::Registry& registry, const std::vector<std::string>& names) noexcept -> void {
+        for(const auto& name : names) {
+            const kstd::reflect::RegistryKey key {kstd::reflect::ElementType::FIELD, "StartupStruct", name, "int"};
+            registry.insert(key, registry.create<kstd::reflect::TypeInfo<kstd::i32>>(name, name));
+        }
+    }
+
+    auto get_snapshot_path(kstd::usize count) noexcept -> std::string {
+        return fmt::format("kstd_reflect_bench_{}.snapshot", count);
+    }
+}// namespace
+
+// Baseline: every key is copied into the pool and the table grows on demand
+static void registry_startup_cold(benchmark::State& state) {
+    const auto names = get_names(static_cast<kstd::usize>(state.range(0)));
+
+    for(auto _ : state) {
+        kstd::reflect::StringPool pool;
+        kstd::reflect::Registry registry {pool};
+        register_fields(registry, names);
+        benchmark::DoNotOptimize(registry.get_size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Maps the snapshot of a previous run and adopts it before registering the same fields
+static void registry_startup_warm(benchmark::State& state) {
+    using namespace kstd::reflect;
+    const auto count = static_cast<kstd::usize>(state.range(0));
+    const auto names = get_names(count);
+    const auto fingerprint = make_snapshot_fingerprint(snapshot_build_id);
+    const auto path = get_snapshot_path(count);
+    {
+        StringPool pool;
+        Registry registry {pool};
+        register_fields(registry, names);
+        (void) save_snapshot(registry, fingerprint, path);
+    }
+
+    for(auto _ : state) {
+        const auto snapshot = RegistrySnapshot::open(path, fingerprint);
+        StringPool pool;
+        Registry registry {pool};
+        (*snapshot)->adopt(registry);
+        register_fields(registry, names);
+        benchmark::DoNotOptimize(registry.get_size());
+    }
+
+    std::remove(path.c_str());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(registry_startup_cold)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(registry_startup_warm)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
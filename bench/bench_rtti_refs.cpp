@@ -0,0 +1,110 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    struct BenchStruct final {
+        kstd::i32 value1;
+        kstd::f32 value2;
+        kstd::u64 value3;
+        kstd::f64 value4;
+        kstd::u8 value5;
+        void* value6;
+        kstd::i64 value7;
+        kstd::u32 value8;
+    };
+
+    // How std::hash<RTTIRef> used to hash, for comparison
+    struct ToStringHash final {
+        auto operator()(const kstd::reflect::RTTIRef& value) const noexcept -> std::size_t {
+            return std::hash<std::string> {}((*value).to_string());
+        }
+    };
+
+    auto get_refs() noexcept -> const std::vector<kstd::reflect::RTTIRef>& {
+        static const std::vector<kstd::reflect::RTTIRef> s_refs {
+                *KSTD_LOOKUP_FIELD_T(BenchStruct, value1), *KSTD_LOOKUP_FIELD_T(BenchStruct, value2),
+                *KSTD_LOOKUP_FIELD_T(BenchStruct, value3), *KSTD_LOOKUP_FIELD_T(BenchStruct, value4),
+                *KSTD_LOOKUP_FIELD_T(BenchStruct, value5), *KSTD_LOOKUP_FIELD_T(BenchStruct, value6),
+                *KSTD_LOOKUP_FIELD_T(BenchStruct, value7), *KSTD_LOOKUP_FIELD_T(BenchStruct, value8)};
+        return s_refs;
+    }
+
+    template<typename H>
+    auto map_insert(benchmark::State& state) -> void {
+        const auto& refs = get_refs();
+
+        for(auto _ : state) {
+            std::unordered_map<kstd::reflect::RTTIRef, kstd::usize, H> map;
+
+            for(kstd::usize index = 0; index < refs.size(); ++index) {
+                map.insert_or_assign(refs[index], index);
+            }
+
+            benchmark::DoNotOptimize(map);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(refs.size()));
+    }
+
+    template<typename H>
+    auto map_find(benchmark::State& state) -> void {
+        const auto& refs = get_refs();
+        std::unordered_map<kstd::reflect::RTTIRef, kstd::usize, H> map;
+
+        for(kstd::usize index = 0; index < refs.size(); ++index) {
+            map.insert_or_assign(refs[index], index);
+        }
+
+        for(auto _ : state) {
+            for(const auto& ref : refs) {
+                benchmark::DoNotOptimize(map.find(ref));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(refs.size()));
+    }
+}// namespace
+
+static void rtti_ref_map_insert(benchmark::State& state) {
+    map_insert<std::hash<kstd::reflect::RTTIRef>>(state);
+}
+
+static void rtti_ref_map_insert_to_string(benchmark::State& state) {
+    map_insert<ToStringHash>(state);
+}
+
+static void rtti_ref_map_find(benchmark::State& state) {
+    map_find<std::hash<kstd::reflect::RTTIRef>>(state);
+}
+
+static void rtti_ref_map_find_to_string(benchmark::State& state) {
+    map_find<ToStringHash>(state);
+}
+
+BENCHMARK(rtti_ref_map_insert);
+BENCHMARK(rtti_ref_map_insert_to_string);
+BENCHMARK(rtti_ref_map_find);
+BENCHMARK(rtti_ref_map_find_to_string);
\ No newline at end of file
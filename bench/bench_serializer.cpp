@@ -0,0 +1,151 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/serializer.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Sample final {
+        kstd::u64 timestamp;
+        kstd::f64 values[6];// NOLINT
+        kstd::u32 sensor;
+        kstd::u32 flags;
+    };
+
+    struct Event final {
+        kstd::u64 id;
+        kstd::u32 kind;
+        std::string source;
+        std::string payload;
+        kstd::f64 weight;
+    };
+
+    auto register_types() noexcept -> void {
+        (void) KSTD_REFLECT_STRUCT(Sample, timestamp, values, sensor, flags);
+        (void) KSTD_REFLECT_STRUCT(Event, id, kind, source, payload, weight);
+    }
+
+    template<typename T>
+    auto make_values() noexcept -> std::vector<T> {
+        register_types();
+        std::vector<T> values(1024);
+
+        for(kstd::usize index = 0; index < values.size(); ++index) {
+            if constexpr(std::is_same_v<T, Event>) {
+                values[index].id = index;
+                values[index].source = "sensor-gateway-eu-west";
+                values[index].payload = std::string(96 + index % 64, 'p');
+            }
+            else {
+                values[index].timestamp = index;
+            }
+        }
+
+        return values;
+    }
+
+    template<typename T>
+    auto serialize_all(const std::vector<T>& values, std::vector<kstd::u8>& buffer) noexcept -> void {
+        buffer.clear();
+
+        for(const auto& value : values) {
+            (void) kstd::reflect::serialize(value, buffer);
+        }
+    }
+
+    template<typename T>
+    auto serialize(benchmark::State& state) -> void {
+        const auto values = make_values<T>();
+        std::vector<kstd::u8> buffer;
+        serialize_all(values, buffer);
+
+        for(auto _ : state) {
+            serialize_all(values, buffer);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+    }
+
+    template<typename T>
+    auto deserialize(benchmark::State& state) -> void {
+        const auto values = make_values<T>();
+        std::vector<kstd::u8> buffer;
+        serialize_all(values, buffer);
+        std::vector<T> results(values.size());
+
+        for(auto _ : state) {
+            kstd::usize offset = 0;
+
+            for(auto& result : results) {
+                offset += *kstd::reflect::deserialize(buffer.data() + offset, buffer.size() - offset, result);
+            }
+
+            benchmark::DoNotOptimize(results.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+    }
+}// namespace
+
+static void serialize_plain(benchmark::State& state) {
+    serialize<Sample>(state);
+}
+
+static void serialize_strings(benchmark::State& state) {
+    serialize<Event>(state);
+}
+
+static void deserialize_plain(benchmark::State& state) {
+    deserialize<Sample>(state);
+}
+
+static void deserialize_strings(benchmark::State& state) {
+    deserialize<Event>(state);
+}
+
+static void view_strings(benchmark::State& state) {
+    const auto values = make_values<Event>();
+    std::vector<kstd::u8> buffer;
+    serialize_all(values, buffer);
+    const auto& id_field = *KSTD_LOOKUP_FIELD_T(Event, id);
+    const auto& payload_field = *KSTD_LOOKUP_FIELD_T(Event, payload);
+
+    for(auto _ : state) {
+        kstd::usize offset = 0;
+
+        while(offset < buffer.size()) {
+            const auto view = *kstd::reflect::SerialView<Event>::create(buffer.data() + offset, buffer.size() - offset);
+            benchmark::DoNotOptimize(view.get(id_field));
+            benchmark::DoNotOptimize(view.get(payload_field).size());
+            offset += view.get_size();
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+}
+
+BENCHMARK(serialize_plain);
+BENCHMARK(serialize_strings);
+BENCHMARK(deserialize_plain);
+BENCHMARK(deserialize_strings);
+BENCHMARK(view_strings);
\ No newline at end of file
@@ -0,0 +1,141 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/soa_vector.hpp>
+#include <vector>
+
+namespace {
+    // Twelve fields, of which the simulation step below only touches two
+    struct Entity final {
+        kstd::f32 position;
+        kstd::f32 velocity;
+        kstd::f32 acceleration;
+        kstd::f32 mass;
+        kstd::f64 energy;
+        kstd::f64 temperature;
+        kstd::u64 id;
+        kstd::u64 owner;
+        kstd::u32 flags;
+        kstd::u32 group;
+        kstd::i64 created;
+        kstd::i64 updated;
+    };
+
+    KSTD_STATIC_REFLECT_STRUCT(Entity, position, velocity, acceleration, mass, energy, temperature, id, owner, flags,
+                               group, created, updated)
+
+    auto make_entity(kstd::usize index) noexcept -> Entity {
+        const auto value = static_cast<kstd::f32>(index);
+        return {value, 1.0F, 0.0F, 1.0F, 0.0, 0.0, index, 0, 0, 0, 0, 0};
+    }
+
+    auto make_aos(kstd::usize count) noexcept -> std::vector<Entity> {
+        std::vector<Entity> entities;
+        entities.reserve(count);
+
+        for(kstd::usize index = 0; index < count; ++index) {
+            entities.push_back(make_entity(index));
+        }
+
+        return entities;
+    }
+
+    auto make_soa(kstd::usize count) noexcept -> kstd::reflect::SoAVector<Entity> {
+        kstd::reflect::SoAVector<Entity> entities;
+        entities.reserve(count);
+
+        for(kstd::usize index = 0; index < count; ++index) {
+            entities.push_back(make_entity(index));
+        }
+
+        return entities;
+    }
+}// namespace
+
+static void integrate_aos(benchmark::State& state) {
+    auto entities = make_aos(static_cast<kstd::usize>(state.range(0)));
+
+    for(auto _ : state) {
+        for(auto& entity : entities) {
+            entity.position += entity.velocity * 0.016F;
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void integrate_soa(benchmark::State& state) {
+    auto entities = make_soa(static_cast<kstd::usize>(state.range(0)));
+
+    for(auto _ : state) {
+        auto* position = entities.get_column<0>();
+        const auto* velocity = entities.get_column<1>();
+        const auto count = entities.get_size();
+
+        for(kstd::usize index = 0; index < count; ++index) {
+            position[index] += velocity[index] * 0.016F;// NOLINT
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void sum_column_aos(benchmark::State& state) {
+    const auto entities = make_aos(static_cast<kstd::usize>(state.range(0)));
+
+    for(auto _ : state) {
+        kstd::f64 sum = 0.0;
+
+        for(const auto& entity : entities) {
+            sum += entity.energy;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void sum_column_soa(benchmark::State& state) {
+    const auto entities = make_soa(static_cast<kstd::usize>(state.range(0)));
+
+    for(auto _ : state) {
+        const auto* energy = entities.get_column<4>();
+        kstd::f64 sum = 0.0;
+
+        for(kstd::usize index = 0; index < entities.get_size(); ++index) {
+            sum += energy[index];// NOLINT
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(integrate_aos)->Range(1 << 10, 1 << 20);
+BENCHMARK(integrate_soa)->Range(1 << 10, 1 << 20);
+BENCHMARK(sum_column_aos)->Range(1 << 10, 1 << 20);
+BENCHMARK(sum_column_soa)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,96 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+#include <vector>
+
+namespace {
+    struct Sample final {
+        kstd::u32 value1;
+        kstd::u32 value2;
+        kstd::u32 value3;
+        kstd::u32 value4;
+    };
+
+    KSTD_STATIC_REFLECT_STRUCT(Sample, value1, value2, value3, value4)
+
+    auto make_samples() noexcept -> std::vector<Sample> {
+        std::vector<Sample> samples(1024);
+        kstd::u32 value = 0;
+
+        for(auto& sample : samples) {
+            sample = {value, value + 1, value + 2, value + 3};
+            value += 4;
+        }
+
+        return samples;
+    }
+}// namespace
+
+// Sums all fields through the FieldInfo instances of the runtime registry
+static void sum_fields_runtime(benchmark::State& state) {
+    using namespace kstd::reflect;
+    const auto& type = *reflect_struct<Sample>();
+    std::vector<const FieldInfo<Sample, kstd::u32>*> fields;
+
+    for(const auto& field : type.get_fields()) {
+        fields.push_back(&*type.get_field(field)->as_field<Sample, kstd::u32>());
+    }
+
+    const auto samples = make_samples();
+
+    for(auto _ : state) {
+        kstd::u64 sum = 0;
+
+        for(const auto& sample : samples) {
+            for(const auto* field : fields) {
+                sum += field->get(&sample);
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(samples.size()));
+}
+
+// Sums all fields through the static field list, which unrolls into direct member accesses
+static void sum_fields_static(benchmark::State& state) {
+    using namespace kstd::reflect;
+    const auto samples = make_samples();
+
+    for(auto _ : state) {
+        kstd::u64 sum = 0;
+
+        for(const auto& sample : samples) {
+            static_type_info<Sample>.for_each_field([&](const auto& field) {
+                sum += field.get(sample);
+            });
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(samples.size()));
+}
+
+BENCHMARK(sum_fields_runtime);
+BENCHMARK(sum_fields_static);
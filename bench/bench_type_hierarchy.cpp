@@ -0,0 +1,112 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+    struct Widget {
+        virtual ~Widget() noexcept = default;
+    };
+
+    struct Clickable {
+        kstd::u32 clicks {0};
+
+        virtual ~Clickable() noexcept = default;
+    };
+
+    struct Panel : Widget {
+        kstd::f32 width {1.0F};
+    };
+
+    struct Button final : Panel, Clickable {};
+
+    struct Label final : Panel {};
+
+    struct Entry final {
+        Widget* widget;
+        const kstd::reflect::RTTI* type;
+    };
+
+    constexpr kstd::usize widget_count = 1024;
+
+    // Holds a mix of widgets, every other one being clickable
+    struct Scene final {
+        std::vector<std::unique_ptr<Widget>> widgets;
+        std::vector<Entry> entries;
+
+        Scene() noexcept {
+            (void) KSTD_REFLECT_BASES(Panel, Widget);
+            (void) KSTD_REFLECT_BASES(Button, Panel, Clickable);
+            (void) KSTD_REFLECT_BASES(Label, Panel);
+
+            for(kstd::usize index = 0; index < widget_count; ++index) {
+                if((index & 1U) == 0) {
+                    widgets.push_back(std::make_unique<Button>());
+                    entries.push_back({widgets.back().get(), &*KSTD_LOOKUP_TYPE(Button)});
+                }
+                else {
+                    widgets.push_back(std::make_unique<Label>());
+                    entries.push_back({widgets.back().get(), &*KSTD_LOOKUP_TYPE(Label)});
+                }
+            }
+        }
+    };
+}// namespace
+
+static void cross_cast_dynamic(benchmark::State& state) {
+    Scene scene {};
+
+    for(auto _ : state) {
+        for(const auto& entry : scene.entries) {
+            benchmark::DoNotOptimize(dynamic_cast<Clickable*>(entry.widget));
+        }
+    }
+}
+
+BENCHMARK(cross_cast_dynamic);
+
+static void cross_cast_reflect(benchmark::State& state) {
+    Scene scene {};
+
+    for(auto _ : state) {
+        for(const auto& entry : scene.entries) {
+            benchmark::DoNotOptimize(kstd::reflect::cast<Clickable>(entry.widget, *entry.type));
+        }
+    }
+}
+
+BENCHMARK(cross_cast_reflect);
+
+static void is_derived_from(benchmark::State& state) {
+    Scene scene {};
+    const auto& clickable = *KSTD_LOOKUP_TYPE(Clickable);
+
+    for(auto _ : state) {
+        for(const auto& entry : scene.entries) {
+            benchmark::DoNotOptimize(entry.type->is_derived_from(clickable));
+        }
+    }
+}
+
+BENCHMARK(is_derived_from);
@@ -0,0 +1,86 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <kstd/reflect/reflection.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace {
+    struct Particle final {
+        kstd::f32 x;
+        kstd::f32 y;
+        kstd::f32 z;
+        kstd::u32 flags;
+    };
+
+    constexpr kstd::usize particle_count = 4096;
+
+    // Copies count elements of a type which is only known through its RTTI
+    auto copy_elements(const kstd::reflect::RTTI& type, void* destination, const void* source,
+                       kstd::usize count) noexcept -> void {
+        const auto& traits = type.get_traits();
+
+        if(traits.is_trivially_copyable) {
+            std::memcpy(destination, source, count * traits.size);
+            return;
+        }
+
+        const auto* lifecycle = type.get_lifecycle();
+        auto* out = static_cast<kstd::u8*>(destination);
+        const auto* in = static_cast<const kstd::u8*>(source);
+
+        for(kstd::usize index = 0; index < count; ++index) {
+            lifecycle->copy_construct(out + index * traits.size, in + index * traits.size);// NOLINT
+        }
+    }
+}// namespace
+
+static void copy_by_lifecycle(benchmark::State& state) {
+    const kstd::reflect::RTTI& type = *KSTD_LOOKUP_TYPE(Particle);
+    const auto* lifecycle = type.get_lifecycle();
+    const std::vector<Particle> source(particle_count);
+    std::vector<Particle> destination(particle_count);
+
+    for(auto _ : state) {
+        for(kstd::usize index = 0; index < particle_count; ++index) {
+            lifecycle->copy_construct(&destination[index], &source[index]);
+        }
+        benchmark::DoNotOptimize(destination.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(copy_by_lifecycle);
+
+static void copy_by_traits(benchmark::State& state) {
+    const kstd::reflect::RTTI& type = *KSTD_LOOKUP_TYPE(Particle);
+    const std::vector<Particle> source(particle_count);
+    std::vector<Particle> destination(particle_count);
+
+    for(auto _ : state) {
+        copy_elements(type, destination.data(), source.data(), particle_count);
+        benchmark::DoNotOptimize(destination.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(copy_by_traits);
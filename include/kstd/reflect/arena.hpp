@@ -0,0 +1,138 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace kstd::reflect {
+    /**
+     * Thread-safe bump allocator for metadata which lives as long as its owner.
+     * Memory is handed out from large chunks and only released, chunk by chunk,
+     * when the arena itself is destroyed. Objects placed into the arena are not
+     * destroyed by it, that is left to whoever created them.
+     */
+    class Arena final {
+        static constexpr usize chunk_size = 64 * 1024;
+        static constexpr usize chunk_alignment = alignof(std::max_align_t);
+
+        struct alignas(std::max_align_t) Chunk final {
+            Chunk* previous;
+            usize size;// Usable bytes following the header
+            usize offset;
+
+            [[nodiscard]] inline auto get_data() noexcept -> u8* {
+                return reinterpret_cast<u8*>(this) + sizeof(Chunk);// NOLINT
+            }
+        };
+
+        static_assert(sizeof(Chunk) % chunk_alignment == 0, "Chunk header breaks the alignment of its data");
+
+        Chunk* _chunk {nullptr};
+        std::mutex _mutex;
+        std::atomic<usize> _byte_size {0};
+        std::atomic<usize> _chunk_count {0};
+
+        // Returns null if the chunk has no room left for the given allocation
+        [[nodiscard]] static inline auto bump(Chunk& chunk, usize size, usize alignment) noexcept -> void* {
+            const auto base = reinterpret_cast<usize>(chunk.get_data());// NOLINT
+            const auto address = (base + chunk.offset + alignment - 1) & ~(alignment - 1);
+            const auto offset = address - base;
+
+            if(offset + size > chunk.size) {
+                return nullptr;
+            }
+
+            chunk.offset = offset + size;
+            return reinterpret_cast<void*>(address);// NOLINT
+        }
+
+        [[nodiscard]] inline auto add_chunk(usize size) noexcept -> Chunk* {
+            auto* memory = ::operator new(sizeof(Chunk) + size, std::align_val_t {chunk_alignment});
+            _byte_size.fetch_add(sizeof(Chunk) + size, std::memory_order_relaxed);
+            _chunk_count.fetch_add(1, std::memory_order_relaxed);
+            return new(memory) Chunk {_chunk, size, 0};
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(Arena)
+
+        constexpr Arena() noexcept = default;
+
+        ~Arena() noexcept {
+            while(_chunk != nullptr) {
+                auto* previous = _chunk->previous;
+                ::operator delete(_chunk, std::align_val_t {chunk_alignment});
+                _chunk = previous;
+            }
+        }
+
+        [[nodiscard]] inline auto allocate(usize size, usize alignment) noexcept -> void* {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            const auto padded_size = size + std::max(alignment, chunk_alignment) - chunk_alignment;
+
+            // Oversized requests get a chunk of their own, which is linked behind the current one
+            if(padded_size > chunk_size / 4) {
+                auto* chunk = add_chunk(padded_size);
+
+                if(_chunk != nullptr) {
+                    chunk->previous = _chunk->previous;
+                    _chunk->previous = chunk;
+                }
+                else {
+                    _chunk = chunk;
+                }
+
+                return bump(*chunk, size, alignment);
+            }
+
+            if(_chunk != nullptr) {
+                if(auto* result = bump(*_chunk, size, alignment); result != nullptr) {
+                    return result;
+                }
+            }
+
+            _chunk = add_chunk(chunk_size);
+            return bump(*_chunk, size, alignment);
+        }
+
+        template<typename T, typename... ARGS>
+        [[nodiscard]] inline auto create(ARGS&&... args) noexcept -> T* {
+            return new(allocate(sizeof(T), alignof(T))) T(std::forward<ARGS>(args)...);
+        }
+
+        // The number of bytes allocated from the system, including unused space
+        [[nodiscard]] inline auto get_byte_size() const noexcept -> usize {
+            return _byte_size.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] inline auto get_chunk_count() const noexcept -> usize {
+            return _chunk_count.load(std::memory_order_relaxed);
+        }
+    };
+}// namespace kstd::reflect
@@ -0,0 +1,255 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+#include <atomic>
+#include <mutex>
+
+namespace kstd::reflect::detail {
+    /**
+     * Append-only, open-addressing hash table of node pointers.
+     * Lookups never lock: they probe the currently published slot array
+     * using acquire loads. Inserts are serialized, which guarantees exactly
+     * one node is published per key. Growing publishes a new slot array and
+     * retires the old one, which stays alive for readers still probing it
+     * until the table itself is destroyed. Nodes are never moved nor freed
+     * before that either, so references to them stay valid.
+     *
+     * NODE has to provide a public u64 hash and a static destroy(NODE*) function.
+     */
+    template<typename NODE>
+    class ConcurrentTable final {
+        static constexpr usize initial_capacity = 64;// Has to be a power of two
+
+        struct Slots final {
+            usize mask;
+            std::atomic<NODE*>* values;
+            Slots* retired;// Previously published slot array
+
+            KSTD_NO_MOVE_COPY(Slots)
+
+            Slots(usize capacity, Slots* retired) noexcept :
+                    mask {capacity - 1},
+                    values {new std::atomic<NODE*>[capacity]()},// NOLINT
+                    retired {retired} {
+            }
+
+            ~Slots() noexcept {
+                delete[] values;// NOLINT
+            }
+        };
+
+        std::atomic<Slots*> _slots {nullptr};
+        std::atomic<usize> _size {0};
+        std::mutex _mutex;
+
+        template<typename P>
+        [[nodiscard]] static inline auto find(const Slots& slots, u64 hash, P& predicate) noexcept -> NODE* {
+            for(auto index = static_cast<usize>(hash) & slots.mask;; index = (index + 1) & slots.mask) {
+                auto* node = slots.values[index].load(std::memory_order_acquire);// NOLINT
+
+                if(node == nullptr) {
+                    return nullptr;
+                }
+
+                if(node->hash == hash && predicate(*node)) {
+                    return node;
+                }
+            }
+        }
+
+        static inline auto place(Slots& slots, NODE* node) noexcept -> void {
+            auto index = static_cast<usize>(node->hash) & slots.mask;
+
+            while(slots.values[index].load(std::memory_order_relaxed) != nullptr) {// NOLINT
+                index = (index + 1) & slots.mask;
+            }
+
+            slots.values[index].store(node, std::memory_order_release);// NOLINT
+        }
+
+        // Keep the load factor at or below 0.75
+        [[nodiscard]] static constexpr auto fits(usize size, usize capacity) noexcept -> bool {
+            return size * 4 <= capacity * 3;
+        }
+
+        [[nodiscard]] inline auto reserve(Slots* slots, usize size) noexcept -> Slots* {
+            if(slots != nullptr && fits(size, slots->mask + 1)) {
+                return slots;
+            }
+
+            auto capacity = slots == nullptr ? initial_capacity : (slots->mask + 1) << 1U;
+
+            while(!fits(size, capacity)) {
+                capacity <<= 1U;
+            }
+
+            auto* new_slots = new Slots(capacity, slots);// NOLINT
+
+            if(slots != nullptr) {
+                for(usize index = 0; index <= slots->mask; ++index) {
+                    auto* node = slots->values[index].load(std::memory_order_relaxed);// NOLINT
+
+                    if(node != nullptr) {
+                        place(*new_slots, node);
+                    }
+                }
+            }
+
+            _slots.store(new_slots, std::memory_order_release);
+            return new_slots;
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(ConcurrentTable)
+
+        constexpr ConcurrentTable() noexcept = default;
+
+        ~ConcurrentTable() noexcept {
+            auto* slots = _slots.load(std::memory_order_acquire);
+
+            if(slots == nullptr) {
+                return;
+            }
+
+            for(usize index = 0; index <= slots->mask; ++index) {
+                auto* node = slots->values[index].load(std::memory_order_relaxed);// NOLINT
+
+                if(node != nullptr) {
+                    NODE::destroy(node);
+                }
+            }
+
+            while(slots != nullptr) {
+                auto* retired = slots->retired;
+                delete slots;// NOLINT
+                slots = retired;
+            }
+        }
+
+        template<typename P>
+        [[nodiscard]] inline auto find(u64 hash, P&& predicate) const noexcept -> NODE* {
+            const auto* slots = _slots.load(std::memory_order_acquire);
+            return slots == nullptr ? nullptr : find(*slots, hash, predicate);
+        }
+
+        /**
+         * Publishes the given node, unless a node the predicate matches was
+         * published before. Returns the published node, so the caller still
+         * owns the given node if the returned one differs from it.
+         */
+        template<typename P>
+        inline auto insert(NODE* node, P&& predicate) noexcept -> NODE* {
+            std::lock_guard<std::mutex> lock {_mutex};
+            auto* slots = _slots.load(std::memory_order_relaxed);
+
+            if(slots != nullptr) {
+                if(auto* existing = find(*slots, node->hash, predicate); existing != nullptr) {
+                    return existing;
+                }
+            }
+
+            const auto size = _size.load(std::memory_order_relaxed);
+            slots = reserve(slots, size + 1);
+            place(*slots, node);
+            _size.store(size + 1, std::memory_order_relaxed);
+            return node;
+        }
+
+        /**
+         * Publishes all given nodes while holding the lock once, growing the table
+         * at most once. Every element of nodes is replaced with the published node
+         * for its key, which the binary predicate compares to existing nodes.
+         */
+        template<typename P>
+        inline auto insert_all(NODE** nodes, usize count, P&& predicate) noexcept -> void {
+            std::lock_guard<std::mutex> lock {_mutex};
+            auto size = _size.load(std::memory_order_relaxed);
+            auto* slots = reserve(_slots.load(std::memory_order_relaxed), size + count);
+
+            for(usize index = 0; index < count; ++index) {
+                auto*& node = nodes[index];// NOLINT
+                auto matches = [&](const NODE& current) noexcept {
+                    return predicate(current, *node);
+                };
+                auto* existing = find(*slots, node->hash, matches);
+
+                if(existing != nullptr) {
+                    node = existing;
+                    continue;
+                }
+
+                place(*slots, node);
+                ++size;
+            }
+
+            _size.store(size, std::memory_order_relaxed);
+        }
+
+        // Grows the table once, so the given number of nodes can be published without growing it again
+        inline auto reserve(usize size) noexcept -> void {
+            std::lock_guard<std::mutex> lock {_mutex};
+            (void) reserve(_slots.load(std::memory_order_relaxed), size);
+        }
+
+        /**
+         * Invokes the given function for every published node.
+         * Nodes published concurrently may or may not be visited.
+         */
+        template<typename F>
+        inline auto for_each(F&& function) const noexcept -> void {
+            const auto* slots = _slots.load(std::memory_order_acquire);
+
+            if(slots == nullptr) {
+                return;
+            }
+
+            for(usize index = 0; index <= slots->mask; ++index) {
+                const auto* node = slots->values[index].load(std::memory_order_acquire);// NOLINT
+
+                if(node != nullptr) {
+                    function(*node);
+                }
+            }
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * The number of bytes occupied by all slot arrays, including retired ones.
+         */
+        [[nodiscard]] inline auto get_byte_size() const noexcept -> usize {
+            usize result = 0;
+
+            for(const auto* slots = _slots.load(std::memory_order_acquire); slots != nullptr;
+                slots = slots->retired) {
+                result += sizeof(Slots) + (slots->mask + 1) * sizeof(std::atomic<NODE*>);
+            }
+
+            return result;
+        }
+    };
+}// namespace kstd::reflect::detail
\ No newline at end of file
@@ -0,0 +1,132 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+// The vector path is compiled for AVX2 regardless of -mavx2 and selected at runtime
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define KSTD_REFLECT_HAS_GATHER
+#endif
+
+#include "static_reflection.hpp"
+#include "type_layout.hpp"
+
+namespace kstd::reflect::detail {
+    // Primitives of 4 or 8 bytes are loaded as raw lanes by the vector path below
+    template<typename T>
+    constexpr bool is_lane_type_v = static_type_info<std::remove_cv_t<T>>.is_primitive() && !std::is_volatile_v<T> &&
+                                    (sizeof(T) == sizeof(u32) || sizeof(T) == sizeof(u64));
+
+#if defined(KSTD_REFLECT_HAS_GATHER)
+    [[nodiscard]] inline auto has_avx2() noexcept -> bool {
+#if defined(__AVX2__)
+        return true;
+#else
+        static const bool s_has_avx2 = [] {
+            __builtin_cpu_init();// May run before the CPU model is initialized otherwise
+            return __builtin_cpu_supports("avx2") != 0;
+        }();
+        return s_has_avx2;
+#endif
+    }
+
+    // Gathers four lanes per step, the index vector holds byte offsets relative to the first value
+    template<typename T>
+    [[nodiscard, gnu::target("avx2")]] inline auto gather_lanes(const u8* bytes, usize stride, usize count, T* out) noexcept -> usize {
+        const auto step = static_cast<long long>(stride);
+        const auto increment = _mm256_set1_epi64x(step * 4);
+        auto indices = _mm256_set_epi64x(step * 3, step * 2, step, 0);
+        usize index = 0;
+
+        for(; index + 4 <= count; index += 4) {
+            if constexpr(sizeof(T) == sizeof(u32)) {
+                const auto values = _mm256_i64gather_epi32(reinterpret_cast<const int*>(bytes), indices, 1);// NOLINT
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), values);                       // NOLINT
+            }
+            else {
+                const auto values = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(bytes), indices,// NOLINT
+                                                            1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + index), values);// NOLINT
+            }
+
+            indices = _mm256_add_epi64(indices, increment);
+        }
+
+        return index;
+    }
+#endif
+
+    /**
+     * Copies the field at the given offset out of count objects which are
+     * stride bytes apart. Densely packed values are copied as a whole.
+     */
+    template<typename T>
+    inline auto gather_field(const void* base, usize offset, usize stride, usize count, T* out) noexcept -> void {
+        static_assert(std::is_copy_assignable_v<T>, "Field type has to be copy assignable");
+        const auto* bytes = static_cast<const u8*>(base) + offset;// NOLINT
+        usize index = 0;
+
+        if constexpr(is_bulk_copyable_v<T>) {
+            if(stride == sizeof(T) && count > 0) {
+                std::memcpy(out, bytes, count * sizeof(T));
+                return;
+            }
+        }
+
+#if defined(KSTD_REFLECT_HAS_GATHER)
+        if constexpr(is_lane_type_v<T>) {
+            if(has_avx2()) {
+                index = gather_lanes(bytes, stride, count, out);
+            }
+        }
+#endif
+
+        for(; index < count; ++index) {
+            out[index] = *reinterpret_cast<const T*>(bytes + index * stride);// NOLINT
+        }
+    }
+
+    /**
+     * Counterpart of gather_field, which writes the given values into count objects.
+     * Vector scatters are slower than scalar stores on current hardware, so this stays scalar.
+     */
+    template<typename T>
+    inline auto scatter_field(void* base, usize offset, usize stride, usize count, const T* in) noexcept -> void {
+        static_assert(std::is_copy_assignable_v<T>, "Field type has to be copy assignable");
+        auto* bytes = static_cast<u8*>(base) + offset;// NOLINT
+
+        if constexpr(is_bulk_copyable_v<T>) {
+            if(stride == sizeof(T) && count > 0) {
+                std::memcpy(bytes, in, count * sizeof(T));
+                return;
+            }
+        }
+
+        for(usize index = 0; index < count; ++index) {
+            *reinterpret_cast<T*>(bytes + index * stride) = in[index];// NOLINT
+        }
+    }
+}// namespace kstd::reflect::detail
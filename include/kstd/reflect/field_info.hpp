@@ -19,8 +19,10 @@
 
 #pragma once
 
+#include "field_batch.hpp"
 #include "reflection_fwd.hpp"
 #include "rtti.hpp"
+#include "type_layout.hpp"
 #include <kstd/utils.hpp>
 #include <string>
 
@@ -40,11 +42,12 @@ namespace kstd::reflect {
         public:
         KSTD_DEFAULT_MOVE_COPY(FieldInfo, Self)
 
-        FieldInfo(std::string mangled_type_name, std::string type_name, const RTTI* enclosing_type,
-                  const std::string& name, usize offset) noexcept :
-                VariableInfo<Type>(std::move(mangled_type_name), std::move(type_name), name),
+        FieldInfo(std::string_view mangled_type_name, std::string_view type_name, const RTTI* enclosing_type,
+                  std::string_view name, usize offset) noexcept :
+                VariableInfo<Type>(mangled_type_name, type_name, name),
                 _enclosing_type {enclosing_type},
                 _offset {offset} {
+            detail::layout_slot<EnclosingType>.add(make_field_layout<Type>(offset, this->_name));
         }
 
         ~FieldInfo() noexcept override = default;
@@ -58,9 +61,13 @@ namespace kstd::reflect {
                                this->get_mangled_type_name());
         }
 
-        [[nodiscard]] auto is_same(const RTTI& other) const noexcept -> bool override {
-            return other.get_element_type() == ElementType::FIELD &&
-                   *(other.template as_field<EnclosingType, Type>()) == *this;
+        [[nodiscard]] auto is_equivalent(const RTTI& other) const noexcept -> bool override {
+            if(other.get_element_type() != ElementType::FIELD) {
+                return false;
+            }
+            const auto& field = *(other.template as_field<EnclosingType, Type>());
+            return _enclosing_type->is_same(*field._enclosing_type) && this->_name == field._name &&
+                   this->get_mangled_type_name() == other.get_mangled_type_name();
         }
 
         [[nodiscard]] inline auto get(const void* memory) const noexcept -> const Type& {
@@ -71,6 +78,28 @@ namespace kstd::reflect {
             *reinterpret_cast<Type*>(reinterpret_cast<u8*>(memory) + _offset) = value;// NOLINT
         }
 
+        /**
+         * Reads this field from count objects starting at base, which are stride
+         * bytes apart, into out. Primitive fields are loaded with vector gathers
+         * where the target supports them.
+         */
+        inline auto gather(const void* base, usize stride, usize count, Type* out) const noexcept -> void {
+            detail::gather_field(base, _offset, stride, count, out);
+        }
+
+        inline auto gather(const EnclosingType* objects, usize count, Type* out) const noexcept -> void {
+            detail::gather_field(objects, _offset, sizeof(EnclosingType), count, out);
+        }
+
+        // Writes count values from in into this field of the objects starting at base
+        inline auto scatter(void* base, usize stride, usize count, const Type* in) const noexcept -> void {
+            detail::scatter_field(base, _offset, stride, count, in);
+        }
+
+        inline auto scatter(EnclosingType* objects, usize count, const Type* in) const noexcept -> void {
+            detail::scatter_field(objects, _offset, sizeof(EnclosingType), count, in);
+        }
+
         [[nodiscard, maybe_unused]] inline auto get_enclosing_type() const noexcept -> const TypeInfo<EnclosingType>& {
             return *reinterpret_cast<const TypeInfo<EnclosingType>*>(_enclosing_type);// NOLINT
         }
@@ -81,8 +110,7 @@ namespace kstd::reflect {
 
         template<typename OET, typename O>
         [[nodiscard]] inline auto operator==(const FieldInfo<OET, O>& other) const noexcept -> bool {
-            return _enclosing_type == other._enclosing_type &&
-                   this->get_mangled_type_name() == other.get_mangled_type_name() && this->_name == other._name;
+            return this->is_same(other);
         }
     };
 }// namespace kstd::reflect
\ No newline at end of file
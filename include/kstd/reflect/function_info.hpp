@@ -22,69 +22,176 @@
 #include <kstd/defaults.hpp>
 #include <kstd/pack.hpp>
 #include <kstd/utils.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <new>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
+#include "function_traits.hpp"
 #include "reflection_fwd.hpp"
 #include "rtti.hpp"
+#include "string_pool.hpp"
 
 namespace kstd::reflect {
-    struct alignas(1) FunctionFlags {
-        [[maybe_unused]] bool is_virtual : 1;
-        [[maybe_unused]] bool is_override : 1;
-        [[maybe_unused]] bool is_final : 1;
-        [[maybe_unused]] bool is_noexcept : 1;
-        [[maybe_unused]] bool is_leading_const : 1;
-        [[maybe_unused]] bool is_trailing_const : 1;
-    };
-
-    namespace {
-        template<typename T, typename... R>
-        inline auto parse_params(std::vector<const RTTI*>& param_types) noexcept -> void {
+    /**
+     * Calls the function described by the given info. Each element of args points
+     * to one argument, preceded by the instance for member functions; the result
+     * is constructed into the uninitialized storage at ret, which may be null to
+     * discard it. Functions returning references store a pointer to the referee.
+     * Arguments for by-value parameters are moved from.
+     * Invokers are noexcept, an exception escaping the function calls std::terminate.
+     */
+    using Invoker = void (*)(const RTTI& function, void* ret, void* const* args) noexcept;
+
+    namespace detail {
+        template<typename T>
+        [[nodiscard]] inline auto lookup_param() noexcept -> const RTTI* {
             auto type_result = lookup<T>();
+            return type_result ? &*type_result : nullptr;
+        }
 
-            if(!type_result) {
-                return;
+        /**
+         * Parameter types are stored inline, unresolvable types are left null.
+         * The return type is only assigned once it could be looked up.
+         * Returns true if every type of the signature could be resolved.
+         */
+        template<typename R, typename... ARGS>
+        [[nodiscard]] inline auto parse_signature(const RTTI*& return_type,
+                                                  std::array<const RTTI*, sizeof...(ARGS)>& param_types) noexcept
+                -> bool {
+            auto return_type_result = lookup<R>();
+
+            if(!return_type_result) {
+                return false;
             }
 
-            param_types.push_back(&*type_result);
+            return_type = &*return_type_result;
+            param_types = {lookup_param<ARGS>()...};
+            return std::all_of(param_types.cbegin(), param_types.cend(), [](const auto* type) {
+                return type != nullptr;
+            });
+        }
+
+        /**
+         * Guards the lazy resolution of all signatures, which happens at most once per function.
+         * Recursive, so lookups made while resolving may resolve another signature on the same thread.
+         */
+        inline std::recursive_mutex signature_mutex;// NOLINT
 
-            if constexpr(sizeof...(R) > 0) {
-                parse_params<R...>(param_types);
+        /**
+         * Thread-safe once-initialization flag. Unlike std::once_flag it can be
+         * copied, a copy starts out unset and initializes its own state again.
+         */
+        class OnceFlag final {
+            mutable std::atomic<bool> _is_set {false};
+
+            public:
+            OnceFlag() noexcept = default;
+
+            OnceFlag(const OnceFlag&) noexcept :
+                    OnceFlag() {
             }
+
+            ~OnceFlag() noexcept = default;
+
+            auto operator=(const OnceFlag&) noexcept -> OnceFlag& {
+                _is_set.store(false, std::memory_order_relaxed);
+                return *this;
+            }
+
+            template<typename F>
+            inline auto call(F&& function) const noexcept -> void {
+                if(_is_set.load(std::memory_order_acquire)) {
+                    return;
+                }
+
+                const std::lock_guard<std::recursive_mutex> lock {signature_mutex};
+
+                if(!_is_set.load(std::memory_order_relaxed)) {
+                    function();
+                    _is_set.store(true, std::memory_order_release);
+                }
+            }
+        };
+
+        // By-value parameters are moved from their argument, so move-only parameter types work as well
+        template<typename T>
+        [[nodiscard]] inline auto unpack_arg(void* arg) noexcept -> T&& {
+            return static_cast<T&&>(*static_cast<std::remove_reference_t<T>*>(arg));
         }
 
-        template<typename R, typename... ARGS>
-        inline auto parse_signature(const RTTI*& return_type, std::vector<const RTTI*>& param_types) noexcept -> void {
-            auto return_type_result = lookup<R>();
+        template<typename R, typename F>
+        inline auto invoke_into(void* ret, F&& function) noexcept -> void {
+            if constexpr(std::is_void_v<R>) {
+                function();
+            }
+            else if constexpr(std::is_reference_v<R>) {
+                R result = function();
 
-            if(!return_type_result) {
-                return;
+                if(ret != nullptr) {
+                    *static_cast<std::remove_reference_t<R>**>(ret) = &result;
+                }
             }
+            else {
+                if(ret == nullptr) {
+                    (void) function();
+                    return;
+                }
 
-            return_type = &*return_type_result;
-            param_types.reserve(sizeof...(ARGS));
-            parse_params<ARGS...>(param_types);
+                new(ret) R(function());
+            }
         }
-    }// namespace
+    }// namespace detail
 
     template<typename R, typename... ARGS>
     struct FunctionInfo : public TypeInfo<R(ARGS...)> {
         using ReturnType = R;
         using ParameterTypes [[maybe_unused]] = Pack<ARGS...>;
+        using FunctionType = ReturnType (*)(ARGS...);
 
         private:
         using Self = FunctionInfo<ReturnType, ARGS...>;
 
-        protected:
-        std::string _name;                    // NOLINT
-        std::vector<const RTTI*> _param_types;// NOLINT
-        const RTTI* _return_type;             // NOLINT
-        FunctionFlags _flags;                 // NOLINT
+        FunctionType _function;
+
+        template<usize... INDICES>
+        static inline auto invoke_unpacked(const RTTI& self, [[maybe_unused]] void* const* args,
+                                           std::index_sequence<INDICES...>) noexcept -> ReturnType {
+            return static_cast<const Self&>(self)._function(detail::unpack_arg<ARGS>(args[INDICES])...);// NOLINT
+        }
 
-        [[nodiscard]] inline auto strip_name(const std::string& name) noexcept -> std::string {
-            std::string result {name};
+        static auto invoke_thunk(const RTTI& self, void* ret, void* const* args) noexcept -> void {
+            detail::invoke_into<ReturnType>(ret, [&]() -> ReturnType {
+                return invoke_unpacked(self, args, std::index_sequence_for<ARGS...> {});
+            });
+        }
+
+        // Looking up the types of the signature registers them, so that is deferred until they are needed
+        inline auto resolve_signature() const noexcept -> void {
+            _is_resolved.call([this] {
+                _has_signature = detail::parse_signature<ReturnType, ARGS...>(_return_type, _param_types);
+            });
+        }
 
-            if(result.find("::") != std::string::npos) {// Name contains namespace qualifier(s)
+        protected:
+        std::string_view _name;                                       // NOLINT - interned
+        mutable std::array<const RTTI*, sizeof...(ARGS)> _param_types;// NOLINT - resolved lazily
+        mutable const RTTI* _return_type;                             // NOLINT - resolved lazily
+        detail::OnceFlag _is_resolved;                                // NOLINT
+        mutable bool _has_signature;                                  // NOLINT - resolved lazily
+        FunctionFlags _flags;                                         // NOLINT
+        Invoker _invoker;                                             // NOLINT
+
+        [[nodiscard]] static inline auto strip_name(std::string_view name) noexcept -> std::string_view {
+            auto result = name;
+
+            if(result.find("::") != std::string_view::npos) {// Name contains namespace qualifier(s)
                 const auto index = result.find_last_of("::");
                 result = result.substr(index + 1);// Strip off namespace qualifier(s)
             }
@@ -92,26 +199,34 @@ namespace kstd::reflect {
             return result;
         }
 
-        private:
-        inline auto parse_flags() noexcept -> void {
-            _flags.is_virtual = this->_type_name.find("virtual") != std::string::npos;
-            _flags.is_override = this->_type_name.find("override") != std::string::npos;
-            _flags.is_final = this->_type_name.find("final") != std::string::npos;
-            _flags.is_noexcept = this->_type_name.find("noexcept") != std::string::npos;
-            _flags.is_leading_const = this->_type_name.find("const") == 0;
-            _flags.is_trailing_const = this->_type_name.rfind("const") == 0;
+        // The stripped name shares the storage of the interned qualified name
+        [[nodiscard]] static inline auto intern_name(std::string_view name) noexcept -> std::string_view {
+            const auto stripped = strip_name(name);
+            const auto offset = static_cast<usize>(stripped.data() - name.data());
+            return get_string_pool().intern_substring(name, offset, stripped.size());
+        }
+
+        protected:
+        FunctionInfo(std::string_view mangled_type_name, std::string_view type_name, std::string_view name,
+                     FunctionType function, Invoker invoker, FunctionFlags flags) noexcept :
+                TypeInfo<ReturnType(ARGS...)>(mangled_type_name, type_name),
+                _function {function},
+                _name {intern_name(name)},
+                _param_types {},
+                _return_type {nullptr},
+                _is_resolved {},
+                _has_signature {false},
+                _flags {flags},
+                _invoker {invoker} {
         }
 
         public:
         KSTD_DEFAULT_MOVE_COPY(FunctionInfo, Self)
 
-        FunctionInfo(std::string mangled_type_name, std::string type_name, const std::string& name) noexcept :
-                TypeInfo<ReturnType(ARGS...)>(std::move(mangled_type_name), std::move(type_name)),
-                _name {strip_name(name)},
-                _return_type {reinterpret_cast<const RTTI*>(&*lookup<void>())},// NOLINT
-                _flags {} {
-            parse_flags();// Parse function flags
-            parse_signature<ReturnType, ARGS...>(_return_type, _param_types);
+        // The flags are those of the declared function, which may be noexcept unlike FunctionType
+        FunctionInfo(std::string_view mangled_type_name, std::string_view type_name, std::string_view name,
+                     FunctionType function, FunctionFlags flags = {}) noexcept :
+                FunctionInfo(mangled_type_name, type_name, name, function, &Self::invoke_thunk, flags) {
         }
 
         ~FunctionInfo() noexcept override = default;
@@ -124,12 +239,15 @@ namespace kstd::reflect {
             return fmt::format("{}:{}", _name, this->get_mangled_type_name());
         }
 
-        [[nodiscard]] auto is_same(const RTTI& other) const noexcept -> bool override {
-            return other.get_element_type() == ElementType::FUNCTION &&
-                   *(other.template as_function<ReturnType, ARGS...>()) == *this;
+        [[nodiscard]] auto is_equivalent(const RTTI& other) const noexcept -> bool override {
+            if(other.get_element_type() != ElementType::FUNCTION) {
+                return false;
+            }
+            const auto& function = *(other.template as_function<ReturnType, ARGS...>());
+            return _name == function._name && this->get_mangled_type_name() == other.get_mangled_type_name();
         }
 
-        [[nodiscard]] inline auto get_name() const noexcept -> const std::string& {
+        [[nodiscard]] inline auto get_name() const noexcept -> std::string_view {
             return _name;
         }
 
@@ -137,16 +255,36 @@ namespace kstd::reflect {
             return _flags;
         }
 
+        [[nodiscard, maybe_unused]] inline auto is_noexcept() const noexcept -> bool {
+            return _flags.is_noexcept;
+        }
+
+        /**
+         * Resolves the types of the signature if that did not happen yet.
+         * Returns false if any of them could not be looked up, in which case
+         * get_return_type and get_param must not be used for the missing ones.
+         */
+        [[nodiscard, maybe_unused]] inline auto has_signature() const noexcept -> bool {
+            resolve_signature();
+            return _has_signature;
+        }
+
         [[nodiscard]] inline auto get_return_type() const noexcept -> const TypeInfo<ReturnType>& {
+            resolve_signature();
+            assert(_return_type != nullptr && "Return type could not be resolved");
             return *reinterpret_cast<const TypeInfo<ReturnType>*>(_return_type);// NOLINT
         }
 
-        [[nodiscard, maybe_unused]] inline auto get_param_types() const noexcept -> const std::vector<const RTTI*>& {
+        [[nodiscard, maybe_unused]] inline auto get_param_types() const noexcept
+                -> const std::array<const RTTI*, sizeof...(ARGS)>& {
+            resolve_signature();
             return _param_types;
         }
 
         template<usize INDEX>
         [[nodiscard]] inline auto get_param() const noexcept -> decltype(auto) {
+            resolve_signature();
+            assert(_param_types[INDEX] != nullptr && "Parameter type could not be resolved");
             return *reinterpret_cast<const TypeInfo<PackElementT<INDEX, Pack<ARGS...>>>*>(// NOLINT
                     _param_types[INDEX]);
         }
@@ -155,9 +293,26 @@ namespace kstd::reflect {
             return sizeof...(ARGS);
         }
 
+        [[nodiscard, maybe_unused]] inline auto get_function() const noexcept -> FunctionType {
+            return _function;
+        }
+
+        [[nodiscard, maybe_unused]] inline auto get_invoker() const noexcept -> Invoker {
+            return _invoker;
+        }
+
+        // Like the invoker, this is noexcept, so the function must not throw
+        inline auto invoke(ARGS... args) const noexcept -> ReturnType {
+            return _function(std::forward<ARGS>(args)...);
+        }
+
+        inline auto invoke_erased(void* ret, void* const* args) const noexcept -> void {
+            _invoker(*this, ret, args);
+        }
+
         template<typename OR, typename... OARGS>
         [[nodiscard]] inline auto operator==(const FunctionInfo<OR, OARGS...>& other) const noexcept -> bool {
-            return this->get_mangled_type_name() == other.get_mangled_type_name() && this->_name == other._name;
+            return this->is_same(other);
         }
     };
 }// namespace kstd::reflect
\ No newline at end of file
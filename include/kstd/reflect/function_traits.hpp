@@ -0,0 +1,110 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/pack.hpp>
+#include <kstd/types.hpp>
+
+#include <type_traits>
+
+namespace kstd::reflect {
+    // Qualifiers of a function type, known at compile time
+    struct alignas(1) FunctionFlags {
+        [[maybe_unused]] bool is_noexcept : 1;
+        [[maybe_unused]] bool is_const : 1;
+        [[maybe_unused]] bool is_volatile : 1;
+        [[maybe_unused]] bool is_lvalue_ref : 1;// Member functions declared with &
+        [[maybe_unused]] bool is_rvalue_ref : 1;// Member functions declared with &&
+    };
+
+    namespace detail {
+        // Splits a function pointer type into its parts, the signature matches the key used by the registry
+        template<typename F>
+        struct FunctionTraits;
+
+        template<typename R, typename S, bool IS_NOEXCEPT, typename... ARGS>
+        struct FreeFunctionTraits {
+            using EnclosingType = void;
+            using ReturnType = R;
+            using ParameterTypes = Pack<ARGS...>;
+            using SignatureType = S;
+            static constexpr usize param_count = sizeof...(ARGS);
+            static constexpr bool is_member = false;
+            static constexpr bool is_const = false;
+            static constexpr bool is_volatile = false;
+            static constexpr bool is_noexcept = IS_NOEXCEPT;
+            static constexpr FunctionFlags flags {IS_NOEXCEPT, false, false, false, false};
+        };
+
+        template<typename R, typename... ARGS>
+        struct FunctionTraits<R (*)(ARGS...)> : FreeFunctionTraits<R, R(ARGS...), false, ARGS...> {};
+
+        template<typename R, typename... ARGS>
+        struct FunctionTraits<R (*)(ARGS...) noexcept> : FreeFunctionTraits<R, R(ARGS...) noexcept, true, ARGS...> {};
+
+        /**
+         * The instance type is what the function has to be invoked on, e.g. const T&&
+         * for a function declared const &&. Functions without a ref-qualifier are
+         * invoked on lvalues.
+         */
+        template<typename ET, typename R, typename S, bool IS_CONST, bool IS_VOLATILE, bool IS_LVALUE_REF,
+                 bool IS_RVALUE_REF, bool IS_NOEXCEPT, typename... ARGS>
+        struct MemberFunctionTraits {
+            using EnclosingType = ET;
+            using ReturnType = R;
+            using ParameterTypes = Pack<ARGS...>;
+            using SignatureType = S;
+            using ConstType = std::conditional_t<IS_CONST, const ET, ET>;
+            using QualifiedType = std::conditional_t<IS_VOLATILE, volatile ConstType, ConstType>;
+            using InstanceType = std::conditional_t<IS_RVALUE_REF, QualifiedType&&, QualifiedType&>;
+            static constexpr usize param_count = sizeof...(ARGS);
+            static constexpr bool is_member = true;
+            static constexpr bool is_const = IS_CONST;
+            static constexpr bool is_volatile = IS_VOLATILE;
+            static constexpr bool is_noexcept = IS_NOEXCEPT;
+            static constexpr FunctionFlags flags {IS_NOEXCEPT, IS_CONST, IS_VOLATILE, IS_LVALUE_REF, IS_RVALUE_REF};
+        };
+
+        // Specializes the traits for one combination of qualifiers, with and without noexcept
+#define KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(q, c, v, l, r)                                                      \
+    template<typename ET, typename R, typename... ARGS>                                                         \
+    struct FunctionTraits<R (ET::*)(ARGS...) q>                                                                 \
+            : MemberFunctionTraits<ET, R, R (ET::*)(ARGS...) q, c, v, l, r, false, ARGS...> {};                 \
+    template<typename ET, typename R, typename... ARGS>                                                         \
+    struct FunctionTraits<R (ET::*)(ARGS...) q noexcept>                                                        \
+            : MemberFunctionTraits<ET, R, R (ET::*)(ARGS...) q noexcept, c, v, l, r, true, ARGS...> {};
+
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(, false, false, false, false)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(const, true, false, false, false)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(volatile, false, true, false, false)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(const volatile, true, true, false, false)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(&, false, false, true, false)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(const&, true, false, true, false)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(volatile&, false, true, true, false)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(const volatile&, true, true, true, false)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(&&, false, false, false, true)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(const&&, true, false, false, true)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(volatile&&, false, true, false, true)
+        KSTD_REFLECT_MEMBER_FUNCTION_TRAITS(const volatile&&, true, true, false, true)
+
+#undef KSTD_REFLECT_MEMBER_FUNCTION_TRAITS
+    }// namespace detail
+}// namespace kstd::reflect
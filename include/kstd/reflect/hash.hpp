@@ -0,0 +1,87 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+#include <cstring>
+#include <string_view>
+
+namespace kstd::reflect {
+    namespace detail {
+        // The 64-bit murmur finalizer
+        [[nodiscard]] constexpr auto mix(u64 value) noexcept -> u64 {
+            value ^= value >> 33U;
+            value *= 0xFF51AFD7ED558CCDULL;
+            value ^= value >> 33U;
+            value *= 0xC4CEB9FE1A85EC53ULL;
+            value ^= value >> 33U;
+            return value;
+        }
+    }// namespace detail
+
+    /**
+     * FNV-1a over the given string followed by the 64-bit murmur finalizer,
+     * so that the low bits used by the registry are well mixed.
+     */
+    [[nodiscard]] constexpr auto hash_string(std::string_view value) noexcept -> u64 {
+        constexpr u64 offset_basis = 0xCBF29CE484222325ULL;
+        constexpr u64 prime = 0x100000001B3ULL;
+
+        u64 result = offset_basis;
+
+        for(const auto current : value) {
+            result ^= static_cast<u8>(current);
+            result *= prime;
+        }
+
+        return detail::mix(result);
+    }
+
+    /**
+     * Hashes raw memory eight bytes at a time, for bulk hashing of values
+     * whose object representation is unique.
+     */
+    [[nodiscard]] inline auto hash_bytes(const void* data, usize size) noexcept -> u64 {
+        constexpr u64 prime = 0x9E3779B97F4A7C15ULL;
+
+        const auto* bytes = static_cast<const u8*>(data);
+        u64 result = size * prime;
+        usize index = 0;
+
+        for(; index + sizeof(u64) <= size; index += sizeof(u64)) {
+            u64 word = 0;
+            std::memcpy(&word, bytes + index, sizeof(u64));// NOLINT
+            result = (result ^ detail::mix(word)) * prime;
+        }
+
+        if(index < size) {
+            u64 word = 0;
+            std::memcpy(&word, bytes + index, size - index);// NOLINT
+            result = (result ^ detail::mix(word)) * prime;
+        }
+
+        return detail::mix(result);
+    }
+
+    [[nodiscard]] constexpr auto hash_combine(u64 seed, u64 value) noexcept -> u64 {
+        return seed ^ (value + 0x9E3779B97F4A7C15ULL + (seed << 6U) + (seed >> 2U));
+    }
+}// namespace kstd::reflect
\ No newline at end of file
@@ -0,0 +1,785 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "reflection.hpp"
+
+namespace kstd::reflect {
+    namespace detail {
+        // Position of the decoder within its input, error is set once decoding failed
+        struct JsonCursor final {
+            const char* current;
+            const char* end;
+            const char* error;
+        };
+
+        [[nodiscard]] inline auto fail(JsonCursor& cursor, const char* error) noexcept -> bool {
+            cursor.error = error;
+            return false;
+        }
+
+#if defined(__SSE2__)
+        [[nodiscard]] inline auto load_block(const char* data) noexcept -> __m128i {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));// NOLINT
+        }
+
+        [[nodiscard]] inline auto match_byte(__m128i block, char value) noexcept -> __m128i {
+            return _mm_cmpeq_epi8(block, _mm_set1_epi8(value));
+        }
+
+        [[nodiscard]] inline auto to_mask(__m128i matches) noexcept -> u32 {
+            return static_cast<u32>(_mm_movemask_epi8(matches));
+        }
+
+        [[nodiscard]] inline auto first_bit(u32 mask) noexcept -> usize {
+            return static_cast<usize>(__builtin_ctz(mask));
+        }
+#endif
+
+        // Returns the first quote, backslash or control character, which ends the plain run of a string
+        [[nodiscard]] inline auto find_string_end(const char* current, const char* end) noexcept -> const char* {
+#if defined(__SSE2__)
+            const auto control_limit = _mm_set1_epi8(0x1F);
+
+            for(; end - current >= 16; current += 16) {// NOLINT
+                const auto block = load_block(current);
+                const auto is_control = _mm_cmpeq_epi8(_mm_max_epu8(block, control_limit), control_limit);
+                const auto mask = to_mask(
+                        _mm_or_si128(_mm_or_si128(match_byte(block, '"'), match_byte(block, '\\')), is_control));
+
+                if(mask != 0) {
+                    return current + first_bit(mask);// NOLINT
+                }
+            }
+#endif
+
+            for(; current < end; ++current) {// NOLINT
+                if(*current == '"' || *current == '\\' || static_cast<u8>(*current) < 0x20) {
+                    break;
+                }
+            }
+
+            return current;
+        }
+
+        // Returns the first character which has to be escaped when encoding, which are the ones ending a plain run
+        [[nodiscard]] inline auto find_escape(const char* current, const char* end) noexcept -> const char* {
+            return find_string_end(current, end);
+        }
+
+        // Returns the first quote, backslash or bracket, which are the only characters changing the nesting depth
+        [[nodiscard]] inline auto find_structural(const char* current, const char* end) noexcept -> const char* {
+#if defined(__SSE2__)
+            for(; end - current >= 16; current += 16) {// NOLINT
+                const auto block = load_block(current);
+                const auto strings = _mm_or_si128(match_byte(block, '"'), match_byte(block, '\\'));
+                const auto arrays = _mm_or_si128(match_byte(block, '['), match_byte(block, ']'));
+                const auto objects = _mm_or_si128(match_byte(block, '{'), match_byte(block, '}'));
+                const auto mask = to_mask(_mm_or_si128(strings, _mm_or_si128(arrays, objects)));
+
+                if(mask != 0) {
+                    return current + first_bit(mask);// NOLINT
+                }
+            }
+#endif
+
+            for(; current < end; ++current) {// NOLINT
+                const auto value = *current;
+
+                if(value == '"' || value == '\\' || value == '[' || value == ']' || value == '{' || value == '}') {
+                    break;
+                }
+            }
+
+            return current;
+        }
+
+        inline auto skip_whitespace(JsonCursor& cursor) noexcept -> void {
+            while(cursor.current < cursor.end) {
+                const auto value = *cursor.current;
+
+                if(value != ' ' && value != '\n' && value != '\r' && value != '\t') {
+                    break;
+                }
+
+                ++cursor.current;// NOLINT
+            }
+        }
+
+        [[nodiscard]] inline auto is_delimiter(char value) noexcept -> bool {
+            return value == ',' || value == '}' || value == ']' || value == ' ' || value == '\n' || value == '\r' ||
+                   value == '\t';
+        }
+
+        // Literals have to end at a delimiter, so "nullx" is no null
+        [[nodiscard]] inline auto consume_literal(JsonCursor& cursor, std::string_view literal) noexcept -> bool {
+            const auto remaining = static_cast<usize>(cursor.end - cursor.current);
+
+            if(remaining < literal.size() || std::memcmp(cursor.current, literal.data(), literal.size()) != 0) {
+                return false;
+            }
+
+            const auto* end = cursor.current + literal.size();// NOLINT
+
+            if(end != cursor.end && !is_delimiter(*end)) {
+                return false;
+            }
+
+            cursor.current = end;
+            return true;
+        }
+
+        [[nodiscard]] inline auto consume(JsonCursor& cursor, char value) noexcept -> bool {
+            skip_whitespace(cursor);
+
+            if(cursor.current == cursor.end || *cursor.current != value) {
+                return false;
+            }
+
+            ++cursor.current;// NOLINT
+            return true;
+        }
+
+        [[nodiscard]] inline auto is_control(char value) noexcept -> bool {
+            return static_cast<u8>(value) < 0x20;
+        }
+
+        // Expects the cursor after the opening quote and leaves it after the closing quote
+        [[nodiscard]] inline auto skip_string(JsonCursor& cursor) noexcept -> bool {
+            while(true) {
+                cursor.current = find_string_end(cursor.current, cursor.end);
+
+                if(cursor.current == cursor.end) {
+                    return fail(cursor, "Unterminated string");
+                }
+
+                if(*cursor.current == '"') {
+                    ++cursor.current;// NOLINT
+                    return true;
+                }
+
+                if(is_control(*cursor.current)) {
+                    return fail(cursor, "Unescaped control character in string");
+                }
+
+                if(cursor.end - cursor.current < 2) {
+                    return fail(cursor, "Unterminated string");
+                }
+
+                cursor.current += 2;// NOLINT - Skip the escaped character
+            }
+        }
+
+        [[nodiscard]] inline auto parse_hex(const char* data, u32& value) noexcept -> bool {
+            value = 0;
+
+            for(usize index = 0; index < 4; ++index) {
+                const auto digit = data[index];// NOLINT
+                value <<= 4U;
+
+                if(digit >= '0' && digit <= '9') {
+                    value |= static_cast<u32>(digit - '0');
+                }
+                else if(digit >= 'a' && digit <= 'f') {
+                    value |= static_cast<u32>(digit - 'a' + 10);
+                }
+                else if(digit >= 'A' && digit <= 'F') {
+                    value |= static_cast<u32>(digit - 'A' + 10);
+                }
+                else {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        inline auto append_utf8(std::string& out, u32 code_point) noexcept -> void {
+            if(code_point < 0x80) {
+                out.push_back(static_cast<char>(code_point));
+            }
+            else if(code_point < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (code_point >> 6U)));
+                out.push_back(static_cast<char>(0x80 | (code_point & 0x3FU)));
+            }
+            else if(code_point < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (code_point >> 12U)));
+                out.push_back(static_cast<char>(0x80 | ((code_point >> 6U) & 0x3FU)));
+                out.push_back(static_cast<char>(0x80 | (code_point & 0x3FU)));
+            }
+            else {
+                out.push_back(static_cast<char>(0xF0 | (code_point >> 18U)));
+                out.push_back(static_cast<char>(0x80 | ((code_point >> 12U) & 0x3FU)));
+                out.push_back(static_cast<char>(0x80 | ((code_point >> 6U) & 0x3FU)));
+                out.push_back(static_cast<char>(0x80 | (code_point & 0x3FU)));
+            }
+        }
+
+        // Expects the cursor after the backslash
+        [[nodiscard]] inline auto parse_escape(JsonCursor& cursor, std::string& out) noexcept -> bool {
+            if(cursor.current == cursor.end) {
+                return fail(cursor, "Unterminated string");
+            }
+
+            const auto value = *cursor.current++;// NOLINT
+
+            switch(value) {
+                case '"':
+                case '\\':
+                case '/': out.push_back(value); return true;
+                case 'b': out.push_back('\b'); return true;
+                case 'f': out.push_back('\f'); return true;
+                case 'n': out.push_back('\n'); return true;
+                case 'r': out.push_back('\r'); return true;
+                case 't': out.push_back('\t'); return true;
+                case 'u': break;
+                default: return fail(cursor, "Invalid escape sequence");
+            }
+
+            u32 code_point = 0;
+
+            if(cursor.end - cursor.current < 4 || !parse_hex(cursor.current, code_point)) {
+                return fail(cursor, "Invalid unicode escape");
+            }
+
+            cursor.current += 4;// NOLINT
+
+            if(code_point >= 0xDC00 && code_point < 0xE000) {
+                return fail(cursor, "Invalid surrogate pair");
+            }
+
+            // High surrogates have to be followed by an escaped low surrogate
+            if(code_point >= 0xD800 && code_point < 0xDC00) {
+                u32 low = 0;
+
+                if(cursor.end - cursor.current < 6 || cursor.current[0] != '\\' || cursor.current[1] != 'u' ||// NOLINT
+                   !parse_hex(cursor.current + 2, low) || low < 0xDC00 || low >= 0xE000) {                   // NOLINT
+                    return fail(cursor, "Invalid surrogate pair");
+                }
+
+                cursor.current += 6;// NOLINT
+                code_point = 0x10000 + ((code_point - 0xD800) << 10U) + (low - 0xDC00);
+            }
+
+            append_utf8(out, code_point);
+            return true;
+        }
+
+        // Expects the cursor after the opening quote, the value reuses the capacity of out
+        [[nodiscard]] inline auto parse_string(JsonCursor& cursor, std::string& out) noexcept -> bool {
+            out.clear();
+
+            while(true) {
+                const auto* run_end = find_string_end(cursor.current, cursor.end);
+                out.append(cursor.current, run_end);
+                cursor.current = run_end;
+
+                if(cursor.current == cursor.end) {
+                    return fail(cursor, "Unterminated string");
+                }
+
+                if(is_control(*run_end)) {
+                    return fail(cursor, "Unescaped control character in string");
+                }
+
+                ++cursor.current;// NOLINT
+
+                if(*run_end == '"') {
+                    return true;
+                }
+
+                if(!parse_escape(cursor, out)) {
+                    return false;
+                }
+            }
+        }
+
+        // Keys are matched against field names, which never contain escapes, so escaped keys match nothing
+        [[nodiscard]] inline auto parse_key(JsonCursor& cursor, std::string_view& key) noexcept -> bool {
+            if(!consume(cursor, '"')) {
+                return fail(cursor, "Expected a key");
+            }
+
+            const auto* begin = cursor.current;
+            const auto* end = find_string_end(begin, cursor.end);
+
+            if(end != cursor.end && *end == '"') {
+                key = {begin, static_cast<usize>(end - begin)};
+                cursor.current = end + 1;// NOLINT
+            }
+            else {
+                key = {};
+
+                if(!skip_string(cursor)) {
+                    return false;
+                }
+            }
+
+            if(!consume(cursor, ':')) {
+                return fail(cursor, "Expected ':' after key");
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] inline auto skip_digits(const char* current, const char* end) noexcept -> const char* {
+            while(current < end && *current >= '0' && *current <= '9') {
+                ++current;// NOLINT
+            }
+
+            return current;
+        }
+
+        // Returns the end of the number at the given position, or null if it does not follow the JSON grammar
+        [[nodiscard]] inline auto scan_number(const char* current, const char* end) noexcept -> const char* {
+            if(current < end && *current == '-') {
+                ++current;// NOLINT
+            }
+
+            if(current == end || *current < '0' || *current > '9') {
+                return nullptr;
+            }
+
+            // No leading zeros
+            current = *current == '0' ? current + 1 : skip_digits(current, end);// NOLINT
+
+            if(current < end && *current == '.') {
+                const auto* fraction = current + 1;// NOLINT
+                current = skip_digits(fraction, end);
+
+                if(current == fraction) {
+                    return nullptr;
+                }
+            }
+
+            if(current < end && (*current == 'e' || *current == 'E')) {
+                ++current;// NOLINT
+
+                if(current < end && (*current == '+' || *current == '-')) {
+                    ++current;// NOLINT
+                }
+
+                const auto* exponent = current;
+                current = skip_digits(exponent, end);
+
+                if(current == exponent) {
+                    return nullptr;
+                }
+            }
+
+            // Numbers have to end at a delimiter, so "01" or "1x" are no numbers
+            if(current != end && !is_delimiter(*current)) {
+                return nullptr;
+            }
+
+            return current;
+        }
+
+        [[nodiscard]] inline auto skip_value(JsonCursor& cursor) noexcept -> bool {
+            skip_whitespace(cursor);
+
+            if(cursor.current == cursor.end) {
+                return fail(cursor, "Expected a value");
+            }
+
+            const auto first = *cursor.current;
+
+            if(first == '"') {
+                ++cursor.current;// NOLINT
+                return skip_string(cursor);
+            }
+
+            if(first == 'n' || first == 't' || first == 'f') {
+                if(consume_literal(cursor, "null") || consume_literal(cursor, "true") ||
+                   consume_literal(cursor, "false")) {
+                    return true;
+                }
+
+                return fail(cursor, "Invalid literal");
+            }
+
+            if(first != '{' && first != '[') {
+                // Anything else has to be a number
+                if(first != '-' && (first < '0' || first > '9')) {
+                    return fail(cursor, "Expected a value");
+                }
+
+                const auto* end = scan_number(cursor.current, cursor.end);
+
+                if(end == nullptr) {
+                    return fail(cursor, "Expected a number");
+                }
+
+                cursor.current = end;
+                return true;
+            }
+
+            // Containers are skipped by jumping between structural characters without looking at their contents
+            usize depth = 0;
+
+            while(true) {
+                cursor.current = find_structural(cursor.current, cursor.end);
+
+                if(cursor.current == cursor.end) {
+                    return fail(cursor, "Unterminated container");
+                }
+
+                switch(*cursor.current++) {// NOLINT
+                    case '"':
+                        if(!skip_string(cursor)) {
+                            return false;
+                        }
+                        break;
+                    case '{':
+                    case '[': ++depth; break;
+                    case '}':
+                    case ']':
+                        if(--depth == 0) {
+                            return true;
+                        }
+                        break;
+                    default: return fail(cursor, "Unexpected escape");
+                }
+            }
+        }
+
+        // The grammar is checked first, since from_chars also accepts inf, nan, "1." and similar
+        template<typename T>
+        [[nodiscard]] inline auto parse_number(JsonCursor& cursor, void* address) noexcept -> bool {
+            const auto* number_end = scan_number(cursor.current, cursor.end);
+
+            if(number_end == nullptr) {
+                return fail(cursor, "Expected a number");
+            }
+
+            T value {};
+            const auto [end, error] = std::from_chars(cursor.current, number_end, value);
+
+            if(error != std::errc {}) {
+                return fail(cursor, error == std::errc::result_out_of_range ? "Number is out of range"
+                                                                            : "Expected a number");
+            }
+
+            // Integers stop at a fraction or exponent
+            if(end != number_end) {
+                return fail(cursor, "Expected an integer");
+            }
+
+            cursor.current = end;
+            std::memcpy(address, &value, sizeof(T));
+            return true;
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto parse_integer(JsonCursor& cursor, void* address, usize size) noexcept -> bool {
+            switch(size) {
+                case sizeof(u8): return parse_number<std::conditional_t<std::is_signed_v<T>, i8, u8>>(cursor, address);
+                case sizeof(u16):
+                    return parse_number<std::conditional_t<std::is_signed_v<T>, i16, u16>>(cursor, address);
+                case sizeof(u32):
+                    return parse_number<std::conditional_t<std::is_signed_v<T>, i32, u32>>(cursor, address);
+                default: return parse_number<T>(cursor, address);
+            }
+        }
+
+        [[nodiscard]] inline auto decode_object(const TypeLayout& layout, u8* destination, JsonCursor& cursor) noexcept
+                -> bool;
+
+        [[nodiscard]] inline auto decode_value(const FieldLayout& field, u8* address, JsonCursor& cursor) noexcept
+                -> bool {
+            skip_whitespace(cursor);
+
+            if(cursor.current == cursor.end) {
+                return fail(cursor, "Expected a value");
+            }
+
+            // Null leaves the field untouched
+            if(*cursor.current == 'n') {
+                return consume_literal(cursor, "null") || fail(cursor, "Invalid literal");
+            }
+
+            switch(field.kind) {
+                case FieldKind::BOOL: {
+                    if(consume_literal(cursor, "true")) {
+                        *reinterpret_cast<bool*>(address) = true;// NOLINT
+                        return true;
+                    }
+
+                    if(consume_literal(cursor, "false")) {
+                        *reinterpret_cast<bool*>(address) = false;// NOLINT
+                        return true;
+                    }
+
+                    return fail(cursor, "Expected a boolean");
+                }
+                case FieldKind::SIGNED: return parse_integer<i64>(cursor, address, field.size);
+                case FieldKind::UNSIGNED: return parse_integer<u64>(cursor, address, field.size);
+                case FieldKind::FLOAT:
+                    return field.size == sizeof(f32) ? parse_number<f32>(cursor, address)
+                                                     : parse_number<f64>(cursor, address);
+                case FieldKind::STRING:
+                    if(*cursor.current != '"') {
+                        return fail(cursor, "Expected a string");
+                    }
+
+                    ++cursor.current;                                                  // NOLINT
+                    return parse_string(cursor, *reinterpret_cast<std::string*>(address));// NOLINT
+                case FieldKind::STRUCT: {
+                    const auto& nested = field.get_layout();
+
+                    if(!nested.get_fields().empty()) {
+                        return decode_object(nested, address, cursor);
+                    }
+
+                    return skip_value(cursor);
+                }
+                default: return skip_value(cursor);
+            }
+        }
+
+        [[nodiscard]] inline auto decode_object(const TypeLayout& layout, u8* destination, JsonCursor& cursor) noexcept
+                -> bool {
+            if(!consume(cursor, '{')) {
+                return fail(cursor, "Expected an object");
+            }
+
+            if(consume(cursor, '}')) {
+                return true;
+            }
+
+            while(true) {
+                std::string_view key;
+
+                if(!parse_key(cursor, key)) {
+                    return false;
+                }
+
+                const auto* field = layout.find_field(key);
+
+                // Const fields cannot be assigned, so their values are skipped like those of unknown keys
+                const auto is_writable = field != nullptr && !field->is_const;
+
+                if(is_writable ? !decode_value(*field, destination + field->offset, cursor)// NOLINT
+                               : !skip_value(cursor)) {
+                    return false;
+                }
+
+                if(consume(cursor, ',')) {
+                    continue;
+                }
+
+                if(consume(cursor, '}')) {
+                    return true;
+                }
+
+                return fail(cursor, "Expected ',' or '}'");
+            }
+        }
+
+        inline auto encode_string(std::string_view value, std::string& out) noexcept -> void {
+            constexpr const char* hex_digits = "0123456789abcdef";
+            const auto* current = value.data();
+            const auto* end = current + value.size();// NOLINT
+            out.push_back('"');
+
+            while(true) {
+                const auto* run_end = find_escape(current, end);
+                out.append(current, run_end);
+
+                if(run_end == end) {
+                    break;
+                }
+
+                const auto character = static_cast<u8>(*run_end);
+                current = run_end + 1;// NOLINT
+
+                switch(character) {
+                    case '"': out.append("\\\""); break;
+                    case '\\': out.append("\\\\"); break;
+                    case '\b': out.append("\\b"); break;
+                    case '\f': out.append("\\f"); break;
+                    case '\n': out.append("\\n"); break;
+                    case '\r': out.append("\\r"); break;
+                    case '\t': out.append("\\t"); break;
+                    default: {
+                        const char escape[] = {'\\', 'u', '0', '0', hex_digits[character >> 4U],// NOLINT
+                                               hex_digits[character & 0xFU]};                     // NOLINT
+                        out.append(escape, sizeof(escape));
+                        break;
+                    }
+                }
+            }
+
+            out.push_back('"');
+        }
+
+        template<typename T>
+        inline auto encode_number(const void* address, std::string& out) noexcept -> void {
+            T value {};
+            std::memcpy(&value, address, sizeof(T));
+
+            if constexpr(std::is_floating_point_v<T>) {
+                if(!std::isfinite(value)) {
+                    out.append("null");
+                    return;
+                }
+            }
+
+            char buffer[32];// NOLINT
+            const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);// NOLINT
+            out.append(buffer, result.ptr);
+        }
+
+        template<typename T>
+        inline auto encode_integer(const void* address, usize size, std::string& out) noexcept -> void {
+            switch(size) {
+                case sizeof(u8): encode_number<std::conditional_t<std::is_signed_v<T>, i8, u8>>(address, out); break;
+                case sizeof(u16): encode_number<std::conditional_t<std::is_signed_v<T>, i16, u16>>(address, out); break;
+                case sizeof(u32): encode_number<std::conditional_t<std::is_signed_v<T>, i32, u32>>(address, out); break;
+                default: encode_number<T>(address, out); break;
+            }
+        }
+
+        [[nodiscard]] inline auto is_json_encodable(const FieldLayout& field) noexcept -> bool {
+            switch(field.kind) {
+                case FieldKind::OTHER: return false;
+                case FieldKind::STRUCT: return !field.get_layout().get_fields().empty();
+                default: return true;
+            }
+        }
+
+        inline auto encode_object(const TypeLayout& layout, const u8* source, std::string& out) noexcept -> void {
+            out.push_back('{');
+            bool is_first = true;
+
+            for(const auto& field : layout.get_fields()) {
+                if(!is_json_encodable(field)) {
+                    continue;
+                }
+
+                if(!is_first) {
+                    out.push_back(',');
+                }
+
+                is_first = false;
+                out.push_back('"');
+                out.append(field.name);
+                out.append("\":");
+                const auto* address = source + field.offset;// NOLINT
+
+                switch(field.kind) {
+                    case FieldKind::BOOL: out.append(*reinterpret_cast<const bool*>(address) ? "true" : "false"); break;
+                    case FieldKind::SIGNED: encode_integer<i64>(address, field.size, out); break;
+                    case FieldKind::UNSIGNED: encode_integer<u64>(address, field.size, out); break;
+                    case FieldKind::FLOAT:
+                        if(field.size == sizeof(f32)) {
+                            encode_number<f32>(address, out);
+                        }
+                        else {
+                            encode_number<f64>(address, out);
+                        }
+                        break;
+                    case FieldKind::STRING: encode_string(*reinterpret_cast<const std::string*>(address), out); break;
+                    default: encode_object(field.get_layout(), address, out); break;
+                }
+            }
+
+            out.push_back('}');
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto get_json_layout() noexcept -> Result<const TypeLayout&> {
+            using namespace std::string_literals;
+            const auto type_result = lookup<T>();
+
+            if(!type_result) {
+                return type_result.template forward<const TypeLayout&>();
+            }
+
+            const auto& layout = type_result->get_layout();
+
+            if(layout.get_fields().empty()) {
+                return Error {"Type has no reflected fields"s};
+            }
+
+            return layout;
+        }
+    }// namespace detail
+
+    /**
+     * Appends the given value as a JSON object to the given buffer and returns the number
+     * of bytes written. Like serialize, only fields which have been looked up are written.
+     * Booleans, numbers, std::string and nested types with reflected fields are supported,
+     * fields of any other type are left out. Reusing the buffer avoids all allocations.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto encode_json(const T& value, std::string& buffer) noexcept -> Result<usize> {
+        const auto layout_result = detail::get_json_layout<T>();
+
+        if(!layout_result) {
+            return layout_result.template forward<usize>();
+        }
+
+        const auto start = buffer.size();
+        detail::encode_object(*layout_result, reinterpret_cast<const u8*>(&value), buffer);// NOLINT
+        return buffer.size() - start;
+    }
+
+    /**
+     * Reads the JSON object at the start of the given input into the given value and returns
+     * the number of bytes consumed, so consecutive records can be decoded from one buffer.
+     * Keys are mapped to fields through the perfect hash of the layout. Unknown keys and
+     * their values are skipped without being parsed or allocated, keys which are missing
+     * or null leave their field untouched. Values of const fields are skipped as well.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto decode_json(std::string_view json, T& value) noexcept -> Result<usize> {
+        const auto layout_result = detail::get_json_layout<T>();
+
+        if(!layout_result) {
+            return layout_result.template forward<usize>();
+        }
+
+        detail::JsonCursor cursor {json.data(), json.data() + json.size(), nullptr};// NOLINT
+
+        if(!detail::decode_object(*layout_result, reinterpret_cast<u8*>(&value), cursor)) {// NOLINT
+            const auto offset = static_cast<usize>(cursor.current - json.data());
+            return Error {fmt::format("{} at offset {}", cursor.error, offset)};
+        }
+
+        return static_cast<usize>(cursor.current - json.data());
+    }
+}// namespace kstd::reflect
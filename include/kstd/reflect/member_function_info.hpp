@@ -24,8 +24,11 @@
 #include <kstd/pack.hpp>
 #include <kstd/utils.hpp>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "element_type.hpp"
+#include "function_traits.hpp"
 #include "reflection_fwd.hpp"
 
 namespace kstd::reflect {
@@ -34,20 +37,88 @@ namespace kstd::reflect {
         using EnclosingType = ET;
         using ReturnType = R;
         using ParameterTypes [[maybe_unused]] = Pack<ARGS...>;
+        using FunctionType = ReturnType (EnclosingType::*)(ARGS...);
+        using ConstFunctionType = ReturnType (EnclosingType::*)(ARGS...) const;
 
         private:
         using Self = MemberFunctionInfo<EnclosingType, ReturnType, ARGS...>;
 
+        // Calls the stored function with the instance cast to what its qualifiers require
+        using QualifiedInvoker = ReturnType (*)(const Self& self, EnclosingType& instance, ARGS... args) noexcept;
+
+        FunctionType _function;// Set for non-const member functions
+
+        // Functions are stored with the nearest unqualified type, which noexcept functions convert to
+        template<typename F>
+        using StoredType = std::conditional_t<std::is_convertible_v<F, FunctionType>, FunctionType,
+                                              std::conditional_t<std::is_convertible_v<F, ConstFunctionType>,
+                                                                 ConstFunctionType, F>>;
+
+        template<typename F>
+        [[nodiscard]] inline auto get_stored_function() const noexcept -> F {
+            if constexpr(std::is_same_v<F, FunctionType>) {
+                return _function;
+            }
+            else if constexpr(std::is_same_v<F, ConstFunctionType>) {
+                return _const_function;
+            }
+            else {
+                return reinterpret_cast<F>(_const_function);// NOLINT - cast back to its declared type
+            }
+        }
+
+        template<typename F, usize... INDICES>
+        static inline auto invoke_unpacked(const RTTI& self, void* const* args,
+                                           std::index_sequence<INDICES...>) noexcept -> ReturnType {
+            using Instance = typename detail::FunctionTraits<F>::InstanceType;
+            const auto& info = static_cast<const Self&>(self);// NOLINT
+            auto& instance = *static_cast<std::remove_reference_t<Instance>*>(args[0]);
+            return (static_cast<Instance>(instance).*info.template get_stored_function<F>())(// NOLINT
+                    detail::unpack_arg<ARGS>(args[INDICES + 1])...);
+        }
+
+        template<typename F>
+        static auto invoke_thunk(const RTTI& self, void* ret, void* const* args) noexcept -> void {
+            detail::invoke_into<ReturnType>(ret, [&]() -> ReturnType {
+                return invoke_unpacked<F>(self, args, std::index_sequence_for<ARGS...> {});
+            });
+        }
+
+        template<typename F>
+        static auto invoke_qualified(const Self& self, EnclosingType& instance, ARGS... args) noexcept -> ReturnType {
+            using Instance = typename detail::FunctionTraits<F>::InstanceType;
+            return (static_cast<Instance>(instance).*self.template get_stored_function<F>())(
+                    std::forward<ARGS>(args)...);
+        }
+
         protected:
-        const RTTI* _enclosing_type;// NOLINT
+        ConstFunctionType _const_function;  // NOLINT - set for const member functions, qualified ones are cast to it
+        QualifiedInvoker _qualified_invoker;// NOLINT - set for volatile or ref-qualified member functions
+        const RTTI* _enclosing_type;        // NOLINT
 
         public:
         KSTD_DEFAULT_MOVE_COPY(MemberFunctionInfo, Self)
 
-        MemberFunctionInfo(std::string mangled_type_name, std::string type_name, const RTTI* enclosing_type,
-                           const std::string& name) noexcept :
-                FunctionInfo<R, ARGS...>(std::move(mangled_type_name), std::move(type_name), name),
+        // Accepts member functions with any combination of cv-, ref- and noexcept-qualifiers
+        template<typename F, typename Traits = detail::FunctionTraits<F>>
+        MemberFunctionInfo(std::string_view mangled_type_name, std::string_view type_name, const RTTI* enclosing_type,
+                           std::string_view name, F function) noexcept :
+                FunctionInfo<R, ARGS...>(mangled_type_name, type_name, name, nullptr,
+                                         &Self::invoke_thunk<StoredType<F>>, Traits::flags),
+                _function {nullptr},
+                _const_function {nullptr},
+                _qualified_invoker {nullptr},
                 _enclosing_type {enclosing_type} {
+            if constexpr(std::is_same_v<StoredType<F>, FunctionType>) {
+                _function = function;
+            }
+            else if constexpr(std::is_same_v<StoredType<F>, ConstFunctionType>) {
+                _const_function = function;
+            }
+            else {
+                _const_function = reinterpret_cast<ConstFunctionType>(function);// NOLINT
+                _qualified_invoker = &Self::invoke_qualified<F>;
+            }
         }
 
         ~MemberFunctionInfo() noexcept override = default;
@@ -61,20 +132,92 @@ namespace kstd::reflect {
                                this->get_mangled_type_name());
         }
 
-        [[nodiscard]] auto is_same(const RTTI& other) const noexcept -> bool override {
-            return other.get_element_type() == ElementType::MEMBER_FUNCTION &&
-                   *(other.template as_member_function<EnclosingType, ReturnType, ARGS...>()) == *this;
+        [[nodiscard]] auto is_equivalent(const RTTI& other) const noexcept -> bool override {
+            if(other.get_element_type() != ElementType::MEMBER_FUNCTION) {
+                return false;
+            }
+            const auto& function = *(other.template as_member_function<EnclosingType, ReturnType, ARGS...>());
+            return _enclosing_type->is_same(*function._enclosing_type) && this->_name == function._name &&
+                   this->get_mangled_type_name() == other.get_mangled_type_name();
         }
 
         [[nodiscard, maybe_unused]] inline auto get_enclosing_type() const noexcept -> const TypeInfo<EnclosingType>& {
             return *reinterpret_cast<const TypeInfo<EnclosingType>*>(_enclosing_type);// NOLINT
         }
 
+        [[nodiscard, maybe_unused]] inline auto is_const() const noexcept -> bool {
+            return this->_flags.is_const;
+        }
+
+        [[nodiscard, maybe_unused]] inline auto is_volatile() const noexcept -> bool {
+            return this->_flags.is_volatile;
+        }
+
+        // Member functions are not stored as free function pointers
+        auto get_function() const noexcept -> typename FunctionInfo<R, ARGS...>::FunctionType = delete;
+
+        /**
+         * Ref-qualified member functions are invoked on the instance cast to the
+         * respective reference, like std::invoke would for an instance of that kind.
+         * Only const member functions may be invoked on const instances, see ConstMemberFunctionInfo.
+         * Like the invoker, this is noexcept, so the function must not throw.
+         */
+        inline auto invoke(EnclosingType& instance, ARGS... args) const noexcept -> ReturnType {
+            if(_function != nullptr) {
+                return (instance.*_function)(std::forward<ARGS>(args)...);
+            }
+
+            if(_qualified_invoker != nullptr) {
+                return _qualified_invoker(*this, instance, std::forward<ARGS>(args)...);
+            }
+
+            return (instance.*_const_function)(std::forward<ARGS>(args)...);
+        }
+
         template<typename OET, typename OR, typename... OARGS>
         [[nodiscard]] inline auto operator==(const MemberFunctionInfo<OET, OR, OARGS...>& other) const noexcept
                 -> bool {
-            return _enclosing_type == other._enclosing_type &&
-                   this->get_mangled_type_name() == other.get_mangled_type_name() && this->_name == other._name;
+            return this->is_same(other);
+        }
+    };
+
+    /**
+     * Describes a const member function which is not rvalue-qualified. Unlike other
+     * member functions it can be invoked on const lvalues, so invoking a mutating
+     * or rvalue-qualified member function on a const lvalue is rejected at compile time.
+     */
+    template<typename ET, typename R, typename... ARGS>
+    struct ConstMemberFunctionInfo final : public MemberFunctionInfo<ET, R, ARGS...> {
+        using EnclosingType = ET;
+        using ReturnType = R;
+
+        private:
+        using Self = ConstMemberFunctionInfo<EnclosingType, ReturnType, ARGS...>;
+        using Base = MemberFunctionInfo<EnclosingType, ReturnType, ARGS...>;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(ConstMemberFunctionInfo, Self)
+
+        template<typename F>
+        ConstMemberFunctionInfo(std::string_view mangled_type_name, std::string_view type_name,
+                                const RTTI* enclosing_type, std::string_view name, F function) noexcept :
+                Base(mangled_type_name, type_name, enclosing_type, name, function) {
+            static_assert(detail::FunctionTraits<F>::is_const && !detail::FunctionTraits<F>::flags.is_rvalue_ref,
+                          "Function cannot be invoked on const lvalues");
+        }
+
+        ~ConstMemberFunctionInfo() noexcept override = default;
+
+        using Base::invoke;
+
+        inline auto invoke(const EnclosingType& instance, ARGS... args) const noexcept -> ReturnType {
+            if(this->_qualified_invoker != nullptr) {
+                // Only set for const volatile and const& functions here, their invoker adds the const back
+                return this->_qualified_invoker(*this, const_cast<EnclosingType&>(instance),// NOLINT
+                                                std::forward<ARGS>(args)...);
+            }
+
+            return (instance.*this->_const_function)(std::forward<ARGS>(args)...);
         }
     };
 }// namespace kstd::reflect
\ No newline at end of file
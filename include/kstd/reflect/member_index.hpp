@@ -0,0 +1,202 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "element_type.hpp"
+#include "hash.hpp"
+#include "perfect_hash.hpp"
+#include "reflection_fwd.hpp"
+
+namespace kstd::reflect {
+    struct MemberEntry final {
+        std::string_view name;// Interned
+        ElementType element_type;
+        const RTTI* value;
+    };
+
+    /**
+     * Immutable index of the registered fields and member functions of a type
+     * by their unqualified name. Names are resolved through a perfect hash, so
+     * a lookup hashes the name once and compares a single entry. Overloads of
+     * a member function share one slot and are stored next to each other.
+     */
+    class MemberIndex final {
+        std::vector<MemberEntry> _entries;// Sorted by name, overloads keep their registration order
+        std::vector<u32> _first_entries;  // Index of the first entry of every distinct name
+        PerfectHash _names;               // Falls back to binary search if it could not be built
+        std::unique_ptr<const MemberIndex> _previous;// Kept alive for concurrent readers
+
+        inline auto build() noexcept -> void {
+            std::vector<u64> hashes;
+
+            for(usize index = 0; index < _entries.size(); ++index) {
+                if(index == 0 || _entries[index].name != _entries[index - 1].name) {
+                    hashes.push_back(hash_string(_entries[index].name));
+                    _first_entries.push_back(static_cast<u32>(index));
+                }
+            }
+
+            _names = PerfectHash {std::move(hashes)};
+        }
+
+        [[nodiscard]] inline auto find_first(std::string_view name) const noexcept -> usize {
+            if(_entries.empty()) {
+                return _entries.size();
+            }
+
+            if(!_names.is_perfect()) {
+                const auto entry = std::lower_bound(_entries.cbegin(), _entries.cend(), name,
+                                                    [](const auto& entry, std::string_view value) {
+                                                        return entry.name < value;
+                                                    });
+                return entry != _entries.cend() && entry->name == name
+                               ? static_cast<usize>(entry - _entries.cbegin())
+                               : _entries.size();
+            }
+
+            const auto slot = _names.find(hash_string(name));
+
+            if(slot == _names.get_size()) {
+                return _entries.size();
+            }
+
+            const auto first = _first_entries[slot];
+            return _entries[first].name == name ? first : _entries.size();
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(MemberIndex)
+
+        MemberIndex() noexcept = default;
+
+        // Creates a copy of the given index which additionally contains the given members
+        MemberIndex(const MemberIndex* previous, const std::vector<MemberEntry>& members) noexcept :
+                _previous {previous} {
+            if(previous != nullptr) {
+                _entries.reserve(previous->_entries.size() + members.size());
+                _entries.assign(previous->_entries.cbegin(), previous->_entries.cend());
+            }
+
+            _entries.insert(_entries.cend(), members.cbegin(), members.cend());
+            std::stable_sort(_entries.begin(), _entries.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.name < rhs.name;
+            });
+            build();
+        }
+
+        ~MemberIndex() noexcept = default;
+
+        [[nodiscard]] inline auto contains(const RTTI* value) const noexcept -> bool {
+            return std::any_of(_entries.cbegin(), _entries.cend(), [value](const auto& entry) {
+                return entry.value == value;
+            });
+        }
+
+        [[nodiscard]] inline auto get_entries() const noexcept -> const std::vector<MemberEntry>& {
+            return _entries;
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _entries.size();
+        }
+
+        // Whether lookups go through the perfect hash instead of a binary search
+        [[nodiscard, maybe_unused]] inline auto is_perfect() const noexcept -> bool {
+            return _names.is_perfect();
+        }
+
+        // Returns the first member of the given element type with the given name, null if there is none
+        [[nodiscard]] inline auto find(std::string_view name, ElementType element_type) const noexcept
+                -> const RTTI* {
+            for(auto index = find_first(name); index < _entries.size() && _entries[index].name == name; ++index) {
+                if(_entries[index].element_type == element_type) {
+                    return _entries[index].value;
+                }
+            }
+
+            return nullptr;
+        }
+    };
+
+    namespace detail {
+        inline const MemberIndex empty_member_index {};// NOLINT
+
+        // Serializes changes to the member index of any type, which only happen during registration
+        inline std::mutex member_index_mutex;// NOLINT
+
+        // Publishes the current member index of a type, each new member replaces it with an extended copy
+        class MemberSlot final {
+            std::atomic<const MemberIndex*> _index {nullptr};
+
+            public:
+            KSTD_NO_MOVE_COPY(MemberSlot)
+
+            MemberSlot() noexcept = default;
+
+            ~MemberSlot() noexcept {
+                delete _index.load(std::memory_order_acquire);
+            }
+
+            [[nodiscard]] inline auto get() const noexcept -> const MemberIndex& {
+                const auto* index = _index.load(std::memory_order_acquire);
+                return index != nullptr ? *index : empty_member_index;
+            }
+
+            // Adding the same member more than once has no effect
+            inline auto add(const MemberEntry& member) noexcept -> void {
+                add_all(&member, 1);
+            }
+
+            // Publishes a single new index for all given members
+            inline auto add_all(const MemberEntry* members, usize count) noexcept -> void {
+                const std::lock_guard<std::mutex> lock {member_index_mutex};
+                const auto* current = _index.load(std::memory_order_relaxed);
+                std::vector<MemberEntry> added;
+                added.reserve(count);
+
+                for(usize index = 0; index < count; ++index) {
+                    const auto& member = members[index];// NOLINT
+
+                    if(current == nullptr || !current->contains(member.value)) {
+                        added.push_back(member);
+                    }
+                }
+
+                if(!added.empty()) {
+                    _index.store(new MemberIndex(current, added), std::memory_order_release);// NOLINT
+                }
+            }
+        };
+
+        template<typename T>
+        inline MemberSlot member_slot;// NOLINT
+    }// namespace detail
+}// namespace kstd::reflect
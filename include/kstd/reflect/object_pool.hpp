@@ -0,0 +1,421 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace kstd::reflect {
+    /**
+     * Thread-safe slab allocator for objects of a single size and alignment.
+     * Freed slots are kept in a free list and handed out again before new
+     * slabs are allocated, so steady-state allocation never reaches the heap.
+     * Slabs are only released when the pool itself is destroyed.
+     */
+    class ObjectPool final {
+        public:
+        // Free slots are linked through their first bytes
+        struct FreeSlot final {
+            FreeSlot* next;
+        };
+
+        private:
+        static constexpr usize initial_slab_capacity = 16;
+        static constexpr usize max_slab_capacity = 4096;
+
+        struct Slab final {
+            Slab* previous;
+        };
+
+        usize _slot_size;
+        usize _alignment;
+        Slab* _slab {nullptr};
+        FreeSlot* _free {nullptr};
+        u8* _cursor {nullptr};// Next unused slot of the current slab
+        u8* _end {nullptr};
+        usize _slab_capacity {initial_slab_capacity};
+        usize _slab_count {0};
+        usize _live_count {0};
+        mutable std::mutex _mutex;
+
+        [[nodiscard]] inline auto get_header_size() const noexcept -> usize {
+            return (sizeof(Slab) + _alignment - 1) & ~(_alignment - 1);
+        }
+
+        inline auto add_slab() noexcept -> void {
+            const auto header_size = get_header_size();
+            auto* memory = ::operator new(header_size + _slot_size * _slab_capacity, std::align_val_t {_alignment});
+            _slab = new(memory) Slab {_slab};
+            _cursor = static_cast<u8*>(memory) + header_size;// NOLINT
+            _end = _cursor + _slot_size * _slab_capacity;     // NOLINT
+            _slab_capacity = std::min(_slab_capacity << 1U, max_slab_capacity);
+            ++_slab_count;
+        }
+
+        [[nodiscard]] inline auto pop() noexcept -> FreeSlot* {
+            if(_free != nullptr) {
+                auto* slot = _free;
+                _free = slot->next;
+                return slot;
+            }
+
+            if(_cursor == _end) {
+                add_slab();
+            }
+
+            auto* slot = reinterpret_cast<FreeSlot*>(_cursor);// NOLINT
+            _cursor += _slot_size;                            // NOLINT
+            return slot;
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(ObjectPool)
+
+        constexpr ObjectPool(usize size, usize alignment) noexcept :
+                _slot_size {0},
+                _alignment {std::max({alignment, alignof(FreeSlot), alignof(Slab)})} {
+            // Every slot has to be able to hold a free list link and keep the next slot aligned
+            _slot_size = (std::max(size, sizeof(FreeSlot)) + _alignment - 1) & ~(_alignment - 1);
+        }
+
+        ~ObjectPool() noexcept {
+            while(_slab != nullptr) {
+                auto* previous = _slab->previous;
+                ::operator delete(_slab, std::align_val_t {_alignment});
+                _slab = previous;
+            }
+        }
+
+        [[nodiscard]] inline auto allocate() noexcept -> void* {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            ++_live_count;
+            return pop();
+        }
+
+        // The given memory has to be allocated from this pool, and no object may live in it anymore
+        inline auto deallocate(void* memory) noexcept -> void {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            _free = new(memory) FreeSlot {_free};
+            --_live_count;
+        }
+
+        // Takes the given number of slots at once, linked into a list
+        [[nodiscard]] inline auto allocate_list(usize count) noexcept -> FreeSlot* {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            FreeSlot* head = nullptr;
+
+            for(usize index = 0; index < count; ++index) {
+                auto* slot = pop();
+                slot->next = head;
+                head = slot;
+            }
+
+            _live_count += count;
+            return head;
+        }
+
+        // Returns the given list of count slots, which ends in last
+        inline auto deallocate_list(FreeSlot* head, FreeSlot* last, usize count) noexcept -> void {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            last->next = _free;
+            _free = head;
+            _live_count -= count;
+        }
+
+        [[nodiscard]] inline auto get_slot_size() const noexcept -> usize {
+            return _slot_size;
+        }
+
+        [[nodiscard]] inline auto get_alignment() const noexcept -> usize {
+            return _alignment;
+        }
+
+        [[nodiscard]] inline auto get_slab_count() const noexcept -> usize {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            return _slab_count;
+        }
+
+        // The number of slots which are currently handed out, including those cached by threads
+        [[nodiscard]] inline auto get_live_count() const noexcept -> usize {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            return _live_count;
+        }
+    };
+
+    namespace detail {
+        // Types of equal size and alignment share their pool, which keeps slabs dense
+        template<usize SIZE, usize ALIGNMENT>
+        inline ObjectPool object_pool {SIZE, ALIGNMENT};// NOLINT
+
+        // Slots each thread keeps for itself, so most allocations never lock the shared pool
+        struct PoolCache final {
+            static constexpr usize batch_size = 32;
+
+            ObjectPool::FreeSlot* head;
+            usize count;
+            bool is_closed;// Set once the thread is shutting down, later frees go to the pool directly
+        };
+
+        template<usize SIZE, usize ALIGNMENT>
+        inline thread_local PoolCache pool_cache {nullptr, 0, false};// NOLINT
+
+        // Trivially destructible on its own, so the cache stays usable while other thread locals are destroyed
+        template<usize SIZE, usize ALIGNMENT>
+        struct PoolCacheFlusher final {
+            KSTD_NO_MOVE_COPY(PoolCacheFlusher)
+
+            constexpr PoolCacheFlusher() noexcept = default;
+
+            ~PoolCacheFlusher() noexcept {
+                auto& cache = pool_cache<SIZE, ALIGNMENT>;
+
+                while(cache.head != nullptr) {
+                    auto* slot = cache.head;
+                    cache.head = slot->next;
+                    object_pool<SIZE, ALIGNMENT>.deallocate(slot);
+                }
+
+                cache.count = 0;
+                cache.is_closed = true;
+            }
+        };
+
+        // Called on every refill, only the first call of each thread constructs the flusher
+        template<usize SIZE, usize ALIGNMENT>
+        inline auto register_pool_cache_flusher() noexcept -> void {
+            static thread_local PoolCacheFlusher<SIZE, ALIGNMENT> flusher;// NOLINT
+            (void) flusher;
+        }
+
+        template<usize SIZE, usize ALIGNMENT>
+        [[nodiscard]] inline auto allocate_pooled() noexcept -> void* {
+            auto& cache = pool_cache<SIZE, ALIGNMENT>;
+
+            if(cache.head == nullptr) {
+                if(cache.is_closed) {
+                    return object_pool<SIZE, ALIGNMENT>.allocate();
+                }
+
+                register_pool_cache_flusher<SIZE, ALIGNMENT>();
+                cache.head = object_pool<SIZE, ALIGNMENT>.allocate_list(PoolCache::batch_size);
+                cache.count = PoolCache::batch_size;
+            }
+
+            auto* slot = cache.head;
+            cache.head = slot->next;
+            --cache.count;
+            return slot;
+        }
+
+        template<usize SIZE, usize ALIGNMENT>
+        inline auto deallocate_pooled(void* memory) noexcept -> void {
+            auto& cache = pool_cache<SIZE, ALIGNMENT>;
+
+            if(cache.is_closed) {
+                object_pool<SIZE, ALIGNMENT>.deallocate(memory);
+                return;
+            }
+
+            cache.head = new(memory) ObjectPool::FreeSlot {cache.head};
+
+            // Hand a batch back, so threads which only free do not hoard slots
+            if(++cache.count == PoolCache::batch_size * 2) {
+                auto* head = cache.head;
+                auto* last = head;
+
+                for(usize index = 1; index < PoolCache::batch_size; ++index) {
+                    last = last->next;
+                }
+
+                cache.head = last->next;
+                cache.count -= PoolCache::batch_size;
+                object_pool<SIZE, ALIGNMENT>.deallocate_list(head, last, PoolCache::batch_size);
+            }
+        }
+    }// namespace detail
+
+    template<typename T>
+    [[nodiscard]] inline auto get_object_pool() noexcept -> ObjectPool& {
+        return detail::object_pool<sizeof(T), alignof(T)>;
+    }
+
+    /**
+     * Standard allocator for single objects from the pool of their type,
+     * array allocations go to the heap. Allows std::allocate_shared to place
+     * the object and its control block into one pooled slot.
+     */
+    template<typename T>
+    struct PoolAllocator final {
+        using value_type = T;
+
+        constexpr PoolAllocator() noexcept = default;
+
+        template<typename U>
+        constexpr PoolAllocator(const PoolAllocator<U>&) noexcept {// NOLINT
+        }
+
+        [[nodiscard]] inline auto allocate(usize count) noexcept -> T* {
+            if(count == 1) {
+                return static_cast<T*>(detail::allocate_pooled<sizeof(T), alignof(T)>());
+            }
+
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t {alignof(T)}));
+        }
+
+        inline auto deallocate(T* memory, usize count) noexcept -> void {
+            if(count == 1) {
+                detail::deallocate_pooled<sizeof(T), alignof(T)>(memory);
+                return;
+            }
+
+            ::operator delete(memory, std::align_val_t {alignof(T)});
+        }
+
+        template<typename U>
+        [[nodiscard]] constexpr auto operator==(const PoolAllocator<U>&) const noexcept -> bool {
+            return true;
+        }
+
+        template<typename U>
+        [[nodiscard]] constexpr auto operator!=(const PoolAllocator<U>&) const noexcept -> bool {
+            return false;
+        }
+    };
+
+    // Destroys objects created in the pool of their type
+    template<typename T>
+    struct PoolDeleter final {
+        inline auto operator()(T* value) const noexcept -> void {
+            value->~T();
+            detail::deallocate_pooled<sizeof(T), alignof(T)>(const_cast<std::remove_cv_t<T>*>(value));// NOLINT
+        }
+    };
+
+    template<typename T>
+    using PoolPtr = std::unique_ptr<T, PoolDeleter<T>>;
+
+    using ConstructFunction = void (*)(void* address) noexcept;
+    using DestructFunction = void (*)(void* address) noexcept;
+    using CopyConstructFunction = void (*)(void* address, const void* source) noexcept;
+    using MoveConstructFunction = void (*)(void* address, void* source) noexcept;
+
+    using AllocateFunction = void* (*) () noexcept;
+    using DeallocateFunction = void (*)(void* memory) noexcept;
+
+    /**
+     * Creates and destroys objects of a type without knowing it statically.
+     * Memory comes from the pool of the type through allocate and deallocate.
+     * Functions are null if the type does not support the respective operation,
+     * constructors which may throw count as unsupported since no function may throw.
+     */
+    struct TypeLifecycle final {
+        usize size;
+        usize alignment;
+        AllocateFunction allocate;
+        DeallocateFunction deallocate;
+        ConstructFunction construct;// Default construction
+        DestructFunction destruct;
+        CopyConstructFunction copy_construct;
+        MoveConstructFunction move_construct;
+    };
+
+    namespace detail {
+        template<typename T>
+        inline auto construct_object(void* address) noexcept -> void {
+            new(address) T();
+        }
+
+        template<typename T>
+        inline auto destruct_object(void* address) noexcept -> void {
+            static_cast<T*>(address)->~T();
+        }
+
+        template<typename T>
+        inline auto copy_construct_object(void* address, const void* source) noexcept -> void {
+            new(address) T(*static_cast<const T*>(source));
+        }
+
+        template<typename T>
+        inline auto move_construct_object(void* address, void* source) noexcept -> void {
+            new(address) T(std::move(*static_cast<T*>(source)));
+        }
+
+        // Arrays, references, functions and void have no lifecycle
+        template<typename T>
+        constexpr bool has_lifecycle_v = std::is_object_v<T> && !std::is_array_v<T>;
+    }// namespace detail
+
+    template<typename T>
+    [[nodiscard]] constexpr auto make_type_lifecycle() noexcept -> TypeLifecycle {
+        using Type = std::remove_cv_t<T>;
+        TypeLifecycle lifecycle {sizeof(Type),
+                                 alignof(Type),
+                                 &detail::allocate_pooled<sizeof(Type), alignof(Type)>,
+                                 &detail::deallocate_pooled<sizeof(Type), alignof(Type)>,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr};
+
+        if constexpr(std::is_nothrow_default_constructible_v<Type>) {
+            lifecycle.construct = &detail::construct_object<Type>;
+        }
+
+        if constexpr(std::is_destructible_v<Type>) {
+            lifecycle.destruct = &detail::destruct_object<Type>;
+        }
+
+        if constexpr(std::is_nothrow_copy_constructible_v<Type>) {
+            lifecycle.copy_construct = &detail::copy_construct_object<Type>;
+        }
+
+        if constexpr(std::is_nothrow_move_constructible_v<Type>) {
+            lifecycle.move_construct = &detail::move_construct_object<Type>;
+        }
+
+        return lifecycle;
+    }
+
+    namespace detail {
+        template<typename T>
+        inline constexpr TypeLifecycle type_lifecycle = make_type_lifecycle<T>();
+    }// namespace detail
+
+    // Destroys type-erased objects created in the pool of their type
+    struct ObjectDeleter final {
+        const TypeLifecycle* lifecycle {nullptr};
+
+        inline auto operator()(void* value) const noexcept -> void {
+            lifecycle->destruct(value);
+            lifecycle->deallocate(value);
+        }
+    };
+
+    using ObjectPtr = std::unique_ptr<void, ObjectDeleter>;
+}// namespace kstd::reflect
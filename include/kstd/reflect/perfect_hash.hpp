@@ -0,0 +1,179 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "hash.hpp"
+
+namespace kstd::reflect {
+    namespace detail {
+        inline constexpr u32 empty_slot = ~u32 {0};
+        inline constexpr u32 max_seed = 1U << 16U;
+
+        [[nodiscard]] constexpr auto next_power_of_two(usize value) noexcept -> usize {
+            usize result = 1;
+
+            while(result < value) {
+                result <<= 1U;
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto get_bucket(u64 hash, usize bucket_count) noexcept -> usize {
+            return static_cast<usize>(hash) & (bucket_count - 1);
+        }
+
+        [[nodiscard]] constexpr auto get_slot(u64 hash, u32 seed, usize slot_count) noexcept -> usize {
+            return static_cast<usize>(mix(hash ^ (seed * 0x9E3779B97F4A7C15ULL))) & (slot_count - 1);
+        }
+
+        /**
+         * Builds a hash-and-displace perfect hash over the given distinct key hashes.
+         * Every bucket gets the first seed which moves all of its keys into free slots,
+         * starting with the largest buckets. The slots have to be filled with empty_slot
+         * beforehand and receive the index of their key. Works on std::array in constant
+         * expressions as well as on std::vector at runtime. Fails if two keys share a hash.
+         */
+        template<typename HASHES, typename SEEDS, typename SLOTS>
+        constexpr auto build_perfect_hash(const HASHES& hashes, usize count, SEEDS& seeds, usize bucket_count,
+                                          SLOTS& slots, usize slot_count) noexcept -> bool {
+            usize max_bucket_size = 0;
+
+            for(usize bucket = 0; bucket < bucket_count; ++bucket) {
+                usize bucket_size = 0;
+
+                for(usize key = 0; key < count; ++key) {
+                    bucket_size += get_bucket(hashes[key], bucket_count) == bucket ? 1 : 0;
+                }
+
+                max_bucket_size = std::max(max_bucket_size, bucket_size);
+            }
+
+            for(auto size = max_bucket_size; size > 0; --size) {
+                for(usize bucket = 0; bucket < bucket_count; ++bucket) {
+                    usize bucket_size = 0;
+
+                    for(usize key = 0; key < count; ++key) {
+                        bucket_size += get_bucket(hashes[key], bucket_count) == bucket ? 1 : 0;
+                    }
+
+                    if(bucket_size != size) {
+                        continue;
+                    }
+
+                    u32 seed = 0;
+
+                    for(; seed < max_seed; ++seed) {
+                        bool is_placed = true;
+
+                        for(usize key = 0; key < count; ++key) {
+                            if(get_bucket(hashes[key], bucket_count) != bucket) {
+                                continue;
+                            }
+
+                            auto& slot = slots[get_slot(hashes[key], seed, slot_count)];
+
+                            if(slot != empty_slot) {
+                                is_placed = false;
+                                break;
+                            }
+
+                            slot = static_cast<u32>(key);
+                        }
+
+                        if(is_placed) {
+                            break;
+                        }
+
+                        // Undo the keys of this bucket placed with the rejected seed
+                        for(usize key = 0; key < count; ++key) {
+                            if(get_bucket(hashes[key], bucket_count) != bucket) {
+                                continue;
+                            }
+
+                            auto& slot = slots[get_slot(hashes[key], seed, slot_count)];
+
+                            if(slot == key) {
+                                slot = empty_slot;
+                            }
+                        }
+                    }
+
+                    if(seed == max_seed) {
+                        return false;
+                    }
+
+                    seeds[bucket] = seed;
+                }
+            }
+
+            return true;
+        }
+    }// namespace detail
+
+    /**
+     * Runtime perfect hash over a set of distinct key hashes, which maps every
+     * key to its index. Lookups read a single seed and a single slot.
+     */
+    class PerfectHash final {
+        std::vector<u64> _hashes;
+        std::vector<u32> _seeds;
+        std::vector<u32> _slots;
+        bool _is_perfect {false};
+
+        public:
+        PerfectHash() noexcept = default;
+
+        explicit PerfectHash(std::vector<u64> hashes) noexcept :
+                _hashes {std::move(hashes)},
+                _seeds(detail::next_power_of_two(_hashes.size()), 0),
+                _slots(detail::next_power_of_two(_hashes.size() << 1U), detail::empty_slot) {
+            _is_perfect = detail::build_perfect_hash(_hashes, _hashes.size(), _seeds, _seeds.size(), _slots,
+                                                     _slots.size());
+        }
+
+        // Building fails if two keys share a hash, callers have to fall back to a search then
+        [[nodiscard]] inline auto is_perfect() const noexcept -> bool {
+            return _is_perfect;
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _hashes.size();
+        }
+
+        // Returns the index of the key with the given hash, or get_size() if there is none
+        [[nodiscard]] inline auto find(u64 hash) const noexcept -> usize {
+            if(!_is_perfect || _hashes.empty()) {
+                return _hashes.size();
+            }
+
+            const auto seed = _seeds[detail::get_bucket(hash, _seeds.size())];
+            const auto slot = _slots[detail::get_slot(hash, seed, _slots.size())];
+            return slot != detail::empty_slot && _hashes[slot] == hash ? slot : _hashes.size();
+        }
+    };
+}// namespace kstd::reflect
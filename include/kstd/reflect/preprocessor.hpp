@@ -0,0 +1,104 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#pragma once
+
+// Applies m(t, x) to every further argument, separated by commas, for up to 32 arguments
+#define KSTD_REFLECT_EXPAND(x) x
+#define KSTD_REFLECT_FOR_EACH_1(m, t, x) m(t, x)
+#define KSTD_REFLECT_FOR_EACH_2(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_1(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_3(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_2(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_4(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_3(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_5(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_4(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_6(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_5(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_7(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_6(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_8(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_7(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_9(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_8(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_10(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_9(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_11(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_10(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_12(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_11(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_13(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_12(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_14(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_13(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_15(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_14(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_16(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_15(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_17(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_16(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_18(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_17(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_19(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_18(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_20(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_19(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_21(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_20(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_22(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_21(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_23(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_22(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_24(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_23(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_25(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_24(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_26(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_25(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_27(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_26(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_28(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_27(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_29(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_28(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_30(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_29(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_31(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_30(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_FOR_EACH_32(m, t, x, ...) \
+    m(t, x), KSTD_REFLECT_EXPAND(KSTD_REFLECT_FOR_EACH_31(m, t, __VA_ARGS__))
+#define KSTD_REFLECT_SELECT_FOR_EACH( \
+        _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, \
+        _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, \
+        _25, _26, _27, _28, _29, _30, _31, _32, NAME, ...) \
+    NAME
+#define KSTD_REFLECT_FOR_EACH(m, t, ...) \
+    KSTD_REFLECT_EXPAND(KSTD_REFLECT_SELECT_FOR_EACH( \
+            __VA_ARGS__, \
+            KSTD_REFLECT_FOR_EACH_32, KSTD_REFLECT_FOR_EACH_31, KSTD_REFLECT_FOR_EACH_30, KSTD_REFLECT_FOR_EACH_29, \
+            KSTD_REFLECT_FOR_EACH_28, KSTD_REFLECT_FOR_EACH_27, KSTD_REFLECT_FOR_EACH_26, KSTD_REFLECT_FOR_EACH_25, \
+            KSTD_REFLECT_FOR_EACH_24, KSTD_REFLECT_FOR_EACH_23, KSTD_REFLECT_FOR_EACH_22, KSTD_REFLECT_FOR_EACH_21, \
+            KSTD_REFLECT_FOR_EACH_20, KSTD_REFLECT_FOR_EACH_19, KSTD_REFLECT_FOR_EACH_18, KSTD_REFLECT_FOR_EACH_17, \
+            KSTD_REFLECT_FOR_EACH_16, KSTD_REFLECT_FOR_EACH_15, KSTD_REFLECT_FOR_EACH_14, KSTD_REFLECT_FOR_EACH_13, \
+            KSTD_REFLECT_FOR_EACH_12, KSTD_REFLECT_FOR_EACH_11, KSTD_REFLECT_FOR_EACH_10, KSTD_REFLECT_FOR_EACH_9, \
+            KSTD_REFLECT_FOR_EACH_8, KSTD_REFLECT_FOR_EACH_7, KSTD_REFLECT_FOR_EACH_6, KSTD_REFLECT_FOR_EACH_5, \
+            KSTD_REFLECT_FOR_EACH_4, KSTD_REFLECT_FOR_EACH_3, KSTD_REFLECT_FOR_EACH_2, KSTD_REFLECT_FOR_EACH_1) \
+    (m, t, __VA_ARGS__))
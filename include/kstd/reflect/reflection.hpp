@@ -22,26 +22,39 @@
 #include <kstd/result.hpp>
 #include <kstd/types.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
 #include <string>
 #include <string_view>
 #include <tuple>
-#include <unordered_map>
+#include <type_traits>
 
 #include <fmt/format.h>
 
-#if !defined(COMPILER_MSVC) && !defined(PLATFORM_WINDOWS)
-#include <cxxabi.h>
-#endif
-
 #include "element_type.hpp"
 #include "field_info.hpp"
 #include "function_info.hpp"
+#include "member_index.hpp"
 #include "member_function_info.hpp"
+#include "object_pool.hpp"
+#include "preprocessor.hpp"
 #include "reflection_fwd.hpp"
+#include "registry.hpp"
+#include "registry_snapshot.hpp"
+#include "registry_stats.hpp"
 #include "rtti.hpp"
 #include "rtti_ref.hpp"
+#include "stat_counters.hpp"
+#include "static_reflection.hpp"
+#include "string_pool.hpp"
+#include "type_hierarchy.hpp"
 #include "type_info.hpp"
+#include "type_name.hpp"
 #include "variable_info.hpp"
 
 // Expressions
@@ -58,154 +71,466 @@
 #define KSTD_LOOKUP_FIELD(r, f) kstd::reflect::lookup_field<decltype(r)>(r.f, #f, offsetof(decltype(r), f))
 // Fields by type
 #define KSTD_LOOKUP_FIELD_T(t, f) kstd::reflect::lookup_field<t, decltype(t::f)>(#f, offsetof(t, f))
+// Types including all given fields
+#define KSTD_REFLECT_STRUCT_FIELD(t, f) kstd::reflect::detail::make_struct_field<t, decltype(t::f)>(#f, offsetof(t, f))
+#define KSTD_REFLECT_STRUCT(t, ...) \
+    kstd::reflect::reflect_struct<t>({KSTD_REFLECT_FOR_EACH(KSTD_REFLECT_STRUCT_FIELD, t, __VA_ARGS__)})
+// Direct base classes of types
+#define KSTD_REFLECT_BASES(t, ...) kstd::reflect::reflect_bases<t, __VA_ARGS__>()
 
 namespace kstd::reflect {
-    namespace {
-        template<typename T>
-        [[nodiscard]] inline auto get_mangled_type_name() noexcept -> std::string {
-#if defined(COMPILER_MSVC) || (defined(PLATFORM_WINDOWS) && defined(COMPILER_CLANG))
-            return {typeid(T).raw_name()};// MSVC provides its own field for the mangled name
-#else
-            return {typeid(T).name()};
-#endif
-        }
+    namespace detail {
+        // Matches FieldInfo and MemberFunctionInfo, which are indexed by their enclosing type
+        template<typename RI, typename = void>
+        struct IsMemberInfo : std::false_type {};
 
-        template<typename T>
-        [[nodiscard]] inline auto get_type_name() noexcept -> Result<std::string> {
-#if defined(COMPILER_MSVC) || (defined(PLATFORM_WINDOWS) && defined(COMPILER_CLANG))
-            return {typeid(T).name()};// MSVC uses the regular name field for the unmangled name
-#else
-            using namespace std::string_literals;
-            i32 status = 0;
-            const auto mangled_name = get_mangled_type_name<T>();
-            auto* ptr = abi::__cxa_demangle(mangled_name.c_str(), nullptr, nullptr, &status);
-
-            switch(status) {
-                case -1: return Error {"Could not allocate memory to demangle"s};
-                case -2: return Error {"Not a valid mangled name"s};
-                case -3: return Error {"Invalid argument"s};
-                default: break;
-            }
-
-            std::string result {ptr};
-            free(ptr);    // Since __cxa_demangle malloc's it's result, we need to free it
-            return result;// MoR
-#endif
-        }
-
-        std::unordered_map<std::string, std::unique_ptr<RTTI>> _types;// NOLINT
+        template<typename RI>
+        struct IsMemberInfo<RI, std::void_t<typename RI::EnclosingType>> : std::true_type {};
 
         template<typename T, typename RI, typename... ARGS>
-        [[nodiscard]] inline auto lookup_named(const std::string& key, ARGS&&... args) noexcept -> Result<const RI&> {
+        [[nodiscard]] inline auto lookup_named(const RegistryKey& key, u64 hash, ARGS&&... args) noexcept
+                -> Result<const RI&> {
             static_assert(std::is_convertible_v<RI*, RTTI*>, "Pointer types are not polymorphically convertible");
 
-            if(_types.find(key) == _types.end()) {
-                auto result = get_type_name<T>();
+            auto& registry = get_registry();
+            const auto* value = registry.find(key, hash);
+
+            if(value != nullptr) {
+                add_to_counter(StatCounter::LOOKUP_HITS);
+            }
+            else {
+                add_to_counter(StatCounter::LOOKUP_MISSES);
+                add_to_counter(StatCounter::TYPE_NAME_CALLS);
+                auto result = [] {
+                    const StatTimer timer {StatCounter::TYPE_NAME_NANOSECONDS};
+                    return get_type_name<T>();
+                }();
 
                 if(!result) {
                     return result.template forward<const RI&>();
                 }
 
-                _types[key] = std::make_unique<RI>(get_mangled_type_name<T>(), *result, std::forward<ARGS>(args)...);
+                // Type names have static storage, so the pool can adopt them instead of copying them
+                auto& pool = get_string_pool();
+                (void) pool.intern_static(key.scope);
+                (void) pool.intern_static(key.signature);
+
+                if(key.element_type == ElementType::TYPE) {
+                    (void) pool.intern_static(key.name);
+                }
+
+                value = &registry.insert(key, hash,
+                                         registry.create<RI>(get_mangled_type_name<T>(), *result,
+                                                             std::forward<ARGS>(args)...));
+
+                if constexpr(IsMemberInfo<RI>::value) {
+                    const auto* member = static_cast<const RI*>(value);
+                    member_slot<typename RI::EnclosingType>.add({member->get_name(), key.element_type, member});
+                }
             }
 
-            return *reinterpret_cast<const RI*>(_types[key].get());// NOLINT
+            return *static_cast<const RI*>(value);
         }
 
         template<typename T, typename RI, typename... ARGS>
         [[nodiscard]] inline auto lookup_default(ARGS&&... args) noexcept -> Result<const RI&> {
             static_assert(std::is_convertible_v<RI*, RTTI*>, "Pointer types are not polymorphically convertible");
-            return lookup_named<T, RI, ARGS...>(get_mangled_type_name<T>(), std::forward<ARGS>(args)...);
+            if constexpr(is_internal_type_v<T>) {
+                const RegistryKey key {ElementType::TYPE, {}, get_internal_type_name<T>(), {}};
+                return lookup_named<T, RI, ARGS...>(key, key.hash(), std::forward<ARGS>(args)...);
+            }
+            else {
+                constexpr RegistryKey key {ElementType::TYPE, {}, type_name_v<T>, {}};
+                constexpr auto hash = key.hash();
+                return lookup_named<T, RI, ARGS...>(key, hash, std::forward<ARGS>(args)...);
+            }
         }
-    }// namespace
+
+        // Caches the registry entry of every type looked up through lookup<T>(), shared by all translation units
+        template<typename T>
+        inline std::atomic<const TypeInfo<T>*> type_slot {nullptr};// NOLINT
+    }// namespace detail
 
     template<typename T>
     [[nodiscard]] inline auto lookup() noexcept -> Result<const TypeInfo<T>&> {
-        return lookup_default<T, TypeInfo<T>>();
+        const auto* info = detail::type_slot<T>.load(std::memory_order_acquire);
+
+        if(info != nullptr) {
+            return *info;
+        }
+
+        auto result = detail::lookup_default<T, TypeInfo<T>>();
+
+        if(result) {
+            // The registry guarantees a single winner, so racing threads all store the same pointer
+            detail::type_slot<T>.store(&*result, std::memory_order_release);
+        }
+
+        return result;
     }
 
     template<typename T>
     [[nodiscard]] inline auto lookup(T*) noexcept -> Result<const TypeInfo<T>&> {// NOLINT
-        return lookup_default<T, TypeInfo<T>>();
+        return lookup<T>();
     }
 
     template<typename T>
     [[nodiscard]] inline auto lookup(T&) noexcept -> Result<const TypeInfo<T>&> {// NOLINT
-        return lookup_default<T, TypeInfo<T>>();
+        return lookup<T>();
     }
 
     template<typename T>
     [[nodiscard]] inline auto lookup(T&&) noexcept -> Result<const TypeInfo<T>&> {// NOLINT
-        return lookup_default<T, TypeInfo<T>>();
+        return lookup<T>();
     }
 
-    template<typename R, typename... ARGS>
-    [[nodiscard]] inline auto lookup_function(R(ARGS...), const std::string& name) noexcept// NOLINT
-            -> Result<const FunctionInfo<R, ARGS...>&> {
-        const auto key = fmt::format("{}({})", name, get_mangled_type_name<R(ARGS...)>());
-        return lookup_named<R(ARGS...), FunctionInfo<R, ARGS...>>(key, name);
+    namespace detail {
+        template<typename ET, typename R, typename PARAMS, bool IS_CONST>
+        struct FunctionInfoFor;
+
+        template<typename R, typename... ARGS>
+        struct FunctionInfoFor<void, R, Pack<ARGS...>, false> final {
+            using Type = FunctionInfo<R, ARGS...>;
+        };
+
+        template<typename ET, typename R, typename... ARGS>
+        struct FunctionInfoFor<ET, R, Pack<ARGS...>, false> final {
+            using Type = MemberFunctionInfo<ET, R, ARGS...>;
+        };
+
+        template<typename ET, typename R, typename... ARGS>
+        struct FunctionInfoFor<ET, R, Pack<ARGS...>, true> final {
+            using Type = ConstMemberFunctionInfo<ET, R, ARGS...>;
+        };
+
+        // Const lvalues can only be passed to const member functions which are not rvalue-qualified
+        template<typename TRAITS>
+        constexpr bool is_const_invocable_v = TRAITS::is_const && !TRAITS::flags.is_rvalue_ref;
+
+        // The RTTI type which describes functions of the given pointer type
+        template<typename F, typename TRAITS = FunctionTraits<F>>
+        using FunctionInfoT = typename FunctionInfoFor<typename TRAITS::EnclosingType, typename TRAITS::ReturnType,
+                                                       typename TRAITS::ParameterTypes,
+                                                       is_const_invocable_v<TRAITS>>::Type;
+
+        template<typename F>
+        constexpr bool is_function_pointer_v = std::is_member_function_pointer_v<F> ||
+                                               (std::is_pointer_v<F> && std::is_function_v<std::remove_pointer_t<F>>);
+    }// namespace detail
+
+    /**
+     * Accepts free and member functions with any combination of cv-, ref- and noexcept-qualifiers.
+     * The qualifiers are detected at compile time through the specializations of detail::FunctionTraits,
+     * the registry key holds the signature including them.
+     */
+    template<typename F, typename = std::enable_if_t<detail::is_function_pointer_v<F>>>
+    [[nodiscard]] inline auto lookup_function(F function, std::string_view name) noexcept
+            -> Result<const detail::FunctionInfoT<F>&> {
+        using Traits = detail::FunctionTraits<F>;
+        using EnclosingType = typename Traits::EnclosingType;
+        using Signature = typename Traits::SignatureType;
+
+        if constexpr(Traits::is_member) {
+            const auto enclosing_type_result = lookup<EnclosingType>();
+
+            if(!enclosing_type_result) {
+                return enclosing_type_result.template forward<const detail::FunctionInfoT<F>&>();
+            }
+
+            const RegistryKey key {ElementType::MEMBER_FUNCTION, get_type_key_name<EnclosingType>(), name,
+                                   type_name_v<Signature>};
+            return detail::lookup_named<Signature, detail::FunctionInfoT<F>>(key, key.hash(), &*enclosing_type_result,
+                                                                              name, function);
+        }
+        else {
+            const RegistryKey key {ElementType::FUNCTION, {}, name, type_name_v<Signature>};
+            return detail::lookup_named<Signature, detail::FunctionInfoT<F>>(key, key.hash(), name, function,
+                                                                              Traits::flags);
+        }
+    }
+
+    template<typename T>
+    [[nodiscard]] inline auto lookup_variable(T&, std::string_view name) noexcept// NOLINT
+            -> Result<const VariableInfo<T>&> {
+        const RegistryKey key {ElementType::VARIABLE, {}, name, type_name_v<T>};
+        return detail::lookup_named<T, VariableInfo<T>>(key, key.hash(), name);
     }
 
-    template<typename ET, typename R, typename... ARGS>
-    [[nodiscard]] inline auto lookup_function(R (ET::*)(ARGS...), const std::string& name) noexcept// NOLINT
-            -> Result<const MemberFunctionInfo<ET, R, ARGS...>&> {
+    template<typename ET, typename T>
+    [[nodiscard]] inline auto lookup_field(T&, std::string_view name, usize offset) noexcept// NOLINT
+            -> Result<const FieldInfo<ET, T>&> {
         const auto enclosing_type_result = lookup<ET>();
 
         if(!enclosing_type_result) {
-            return enclosing_type_result.template forward<const MemberFunctionInfo<ET, R, ARGS...>&>();
+            return enclosing_type_result.template forward<const FieldInfo<ET, T>&>();
         }
 
-        const auto key = fmt::format("{}::{}({})", enclosing_type_result->get_mangled_type_name(), name,
-                                     get_mangled_type_name<R (ET::*)(ARGS...) const>());
-        return lookup_named<R (ET::*)(ARGS...), MemberFunctionInfo<ET, R, ARGS...>>(
-                key, &enclosing_type_result.borrow(), name);
+        const RegistryKey key {ElementType::FIELD, get_type_key_name<ET>(), name, type_name_v<T>};
+        return detail::lookup_named<T, FieldInfo<ET, T>>(key, key.hash(), &*enclosing_type_result, name, offset);
     }
 
-    template<typename ET, typename R, typename... ARGS>
-    [[nodiscard]] inline auto lookup_function(R (ET::*)(ARGS...) const, const std::string& name) noexcept// NOLINT
-            -> Result<const MemberFunctionInfo<ET, R, ARGS...>&> {
+    template<typename ET, typename T>
+    [[nodiscard]] inline auto lookup_field(std::string_view name, usize offset) noexcept
+            -> Result<const FieldInfo<ET, T>&> {
         const auto enclosing_type_result = lookup<ET>();
 
         if(!enclosing_type_result) {
-            return enclosing_type_result.template forward<const MemberFunctionInfo<ET, R, ARGS...>&>();
+            return enclosing_type_result.template forward<const FieldInfo<ET, T>&>();
         }
 
-        const auto key = fmt::format("{}::{}({})", enclosing_type_result->get_mangled_type_name(), name,
-                                     get_mangled_type_name<R (ET::*)(ARGS...) const>());
-        return lookup_named<R (ET::*)(ARGS...) const, MemberFunctionInfo<ET, R, ARGS...>>(key, &*enclosing_type_result,
-                                                                                          name);
+        const RegistryKey key {ElementType::FIELD, get_type_key_name<ET>(), name, type_name_v<T>};
+        return detail::lookup_named<T, FieldInfo<ET, T>>(key, key.hash(), &*enclosing_type_result, name, offset);
     }
 
+    namespace detail {
+        using FieldFactory = RTTIPtr (*)(Registry& registry, const RTTI* enclosing_type, std::string_view name,
+                                         usize offset) noexcept;
+
+        // Describes a field passed to reflect_struct, the layout is known at compile time
+        struct StructField final {
+            FieldLayout layout;
+            FieldFactory create;
+        };
+
+        template<typename ET, typename T>
+        [[nodiscard]] inline auto create_field(Registry& registry, const RTTI* enclosing_type, std::string_view name,
+                                               usize offset) noexcept -> RTTIPtr {
+            auto result = get_type_name<T>();
+
+            if(!result) {
+                return nullptr;
+            }
+
+            return registry.create<FieldInfo<ET, T>>(get_mangled_type_name<T>(), *result, enclosing_type, name,
+                                                     offset);
+        }
+
+        template<typename ET, typename T>
+        [[nodiscard]] inline auto make_struct_field(std::string_view name, usize offset) noexcept -> StructField {
+            return {make_field_layout<T>(offset, name), &create_field<ET, T>};
+        }
+    }// namespace detail
+
+    /**
+     * Registers the given type and all given fields in one batch, which publishes
+     * a single layout and inserts all fields into the registry at once.
+     * The first call also declares the given fields as the fixed layout of the type,
+     * which the serializer uses regardless of any fields looked up later on.
+     * Use KSTD_REFLECT_STRUCT(t, f1, f2, ...) instead of invoking this directly.
+     */
     template<typename T>
-    [[nodiscard]] inline auto lookup_variable(T&, const std::string& name) noexcept// NOLINT
-            -> Result<const VariableInfo<T>&> {
-        return lookup_named<T, VariableInfo<T>>(std::string(name), name);
+    [[nodiscard]] inline auto reflect_struct(std::initializer_list<detail::StructField> fields) noexcept
+            -> Result<const TypeInfo<T>&> {
+        using namespace std::string_literals;
+        const auto type_result = lookup<T>();
+
+        if(!type_result) {
+            return type_result;
+        }
+
+        const auto& type = *type_result;
+        const auto& current_layout = type.get_layout();
+
+        // Fields may have been looked up individually before, which does not declare them
+        if(detail::layout_slot<T>.get_declared() != nullptr &&
+           std::all_of(fields.begin(), fields.end(), [&current_layout](const auto& field) {
+               return current_layout.contains(field.layout.offset, field.layout.type_id);
+           })) {
+            return type;// Already registered
+        }
+
+        // Names come from the macro and have static storage, so the pool can adopt them
+        auto& pool = get_string_pool();
+        const auto scope = get_type_key_name<T>();
+        (void) pool.intern_static(scope);
+
+        std::vector<FieldLayout> layouts;
+        layouts.reserve(fields.size());
+
+        for(const auto& field : fields) {
+            auto& layout = layouts.emplace_back(field.layout);
+            layout.name = pool.intern_static(layout.name);
+            (void) pool.intern_static(layout.type_name);
+        }
+
+        // Publish the layout first, so the field infos created below do not extend it one by one
+        detail::layout_slot<T>.declare(layouts.data(), layouts.size());
+
+        auto& registry = get_registry();
+        std::vector<Registry::Insertion> insertions;
+        insertions.reserve(fields.size());
+        auto field = fields.begin();
+
+        for(const auto& layout : layouts) {
+            auto value = field->create(registry, &type, layout.name, layout.offset);
+
+            if(value == nullptr) {
+                return Error {"Could not resolve field type name"s};
+            }
+
+            const RegistryKey key {ElementType::FIELD, scope, layout.name, layout.type_name};
+            insertions.push_back({key, key.hash(), std::move(value), nullptr});
+            ++field;
+        }
+
+        registry.insert_all(insertions);
+
+        std::vector<MemberEntry> members;
+        members.reserve(insertions.size());
+
+        for(usize index = 0; index < insertions.size(); ++index) {
+            members.push_back({layouts[index].name, ElementType::FIELD, insertions[index].result});
+        }
+
+        detail::member_slot<T>.add_all(members.data(), members.size());
+        return type;
+    }
+
+    // Runtime RTTI derived from the static reflection tier
+
+    template<typename T>
+    [[nodiscard]] inline auto lookup(const StaticTypeInfo<T>&) noexcept -> Result<const TypeInfo<T>&> {// NOLINT
+        return lookup<T>();
     }
 
     template<typename ET, typename T>
-    [[nodiscard]] inline auto lookup_field(T&, const std::string& name, usize offset) noexcept// NOLINT
+    [[nodiscard]] inline auto lookup_field(const StaticFieldInfo<ET, T>& field) noexcept
             -> Result<const FieldInfo<ET, T>&> {
-        const auto enclosing_type_result = lookup<ET>();
+        return lookup_field<ET, T>(field.name, field.offset);
+    }
 
-        if(!enclosing_type_result) {
-            return enclosing_type_result.template forward<const FieldInfo<ET, T>&>();
+    template<auto FUNCTION>
+    [[nodiscard]] inline auto lookup_function(const StaticFunctionInfo<FUNCTION>&, std::string_view name) noexcept
+            -> decltype(lookup_function(FUNCTION, name)) {// NOLINT
+        return lookup_function(FUNCTION, name);
+    }
+
+    /**
+     * Registers the given type with all fields declared through
+     * KSTD_STATIC_REFLECT_STRUCT, like KSTD_REFLECT_STRUCT would.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto reflect_struct() noexcept -> Result<const TypeInfo<T>&> {
+        static_assert(static_type_info<T>.get_field_count() > 0, "Type has no static field list");
+        return std::apply(
+                [](const auto&... fields) {
+                    return reflect_struct<T>({detail::make_struct_field<T, typename std::decay_t<decltype(fields)>::Type>(
+                            fields.name, fields.offset)...});
+                },
+                static_field_list<T>);
+    }
+
+    // Inheritance
+
+    namespace detail {
+        // Fails for virtual and ambiguous bases, whose subobjects have no fixed offset
+        template<typename T, typename B, typename = void>
+        struct HasFixedBaseOffset : std::false_type {};
+
+        template<typename T, typename B>
+        struct HasFixedBaseOffset<T, B, std::void_t<decltype(static_cast<T*>(std::declval<B*>()))>>
+                : std::true_type {};
+
+        template<typename T, typename B>
+        [[nodiscard]] inline auto get_base_offset() noexcept -> usize {
+            // Any suitably aligned address will do, the pointer is never dereferenced
+            constexpr usize address = 0x1000;
+            static_assert(alignof(T) <= address, "Type is over-aligned");
+            auto* derived = reinterpret_cast<T*>(address);                     // NOLINT
+            return reinterpret_cast<usize>(static_cast<B*>(derived)) - address;// NOLINT
+        }
+
+        // Reads the type slot first, casts would spend most of their time creating a Result otherwise
+        template<typename B>
+        [[nodiscard]] inline auto lookup_base() noexcept -> const RTTI* {
+            if(const auto* info = type_slot<B>.load(std::memory_order_acquire); info != nullptr) {
+                return info;
+            }
+
+            const auto result = lookup<B>();
+            return result ? &*result : nullptr;
+        }
+
+        // The offset of the given base within an object of the given type, or invalid_base_offset
+        [[nodiscard]] inline auto get_base_offset(const RTTI& type, const RTTI& base) noexcept -> usize {
+            if(type.is_same(base)) {
+                return 0;
+            }
+
+            const auto* hierarchy = type.get_hierarchy();
+            return hierarchy != nullptr ? hierarchy->get_offset(base) : invalid_base_offset;
+        }
+    }// namespace detail
+
+    /**
+     * Registers the given direct base classes of a type, which makes them known to
+     * RTTI::is_derived_from and cast. Bases may be registered in any order.
+     * Use KSTD_REFLECT_BASES(t, b1, b2, ...) instead of invoking this directly.
+     */
+    template<typename T, typename... BASES>
+    [[nodiscard]] inline auto reflect_bases() noexcept -> Result<const TypeInfo<T>&> {
+        using namespace std::string_literals;
+        static_assert(sizeof...(BASES) > 0, "At least one base has to be given");
+        static_assert((std::is_base_of_v<BASES, T> && ...), "Type does not derive from all given bases");
+        static_assert((detail::HasFixedBaseOffset<T, BASES>::value && ...),
+                      "Virtual and ambiguous bases are not supported");
+        const auto type_result = lookup<T>();
+
+        if(!type_result) {
+            return type_result;
+        }
+
+        const std::array<BaseEntry, sizeof...(BASES)> bases {
+                BaseEntry {detail::lookup_base<BASES>(), detail::get_base_offset<T, BASES>(), false}...};
+
+        if(std::any_of(bases.cbegin(), bases.cend(), [](const auto& base) {
+               return base.type == nullptr;
+           })) {
+            return Error {"Could not resolve base type"s};
         }
 
-        const auto key = fmt::format("{}::{}", enclosing_type_result->get_mangled_type_name(), name);
-        return lookup_named<T, FieldInfo<ET, T>>(key, &*enclosing_type_result, name, offset);
+        detail::hierarchy_slot<T>.add_all(bases.data(), bases.size());
+        return type_result;
     }
 
-    template<typename ET, typename T>
-    [[nodiscard]] inline auto lookup_field(const std::string& name, usize offset) noexcept
-            -> Result<const FieldInfo<ET, T>&> {
-        const auto enclosing_type_result = lookup<ET>();
+    /**
+     * Converts a pointer to an object whose dynamic type is described by the given
+     * RTTI, and which is seen as FROM, to a pointer to TO. Upcasts, downcasts and
+     * cross casts between registered bases all resolve in constant time, without
+     * dynamic_cast. Passing a void pointer requires it to point to the whole object.
+     * Returns null if either type is not a unique base of the dynamic type.
+     */
+    template<typename TO, typename FROM>
+    [[nodiscard]] inline auto cast(FROM* object, const RTTI& type) noexcept
+            -> std::conditional_t<std::is_const_v<FROM>, const TO, TO>* {
+        using Target = std::conditional_t<std::is_const_v<FROM>, const TO, TO>;
+        using Byte = std::conditional_t<std::is_const_v<FROM>, const u8, u8>;
+
+        if(object == nullptr) {
+            return nullptr;
+        }
 
-        if(!enclosing_type_result) {
-            return enclosing_type_result.template forward<const FieldInfo<ET, T>&>();
+        auto* bytes = reinterpret_cast<Byte*>(object);// NOLINT
+
+        if constexpr(!std::is_void_v<FROM>) {
+            const auto* source = detail::lookup_base<std::remove_cv_t<FROM>>();
+            const auto offset = source != nullptr ? detail::get_base_offset(type, *source) : invalid_base_offset;
+
+            if(offset == invalid_base_offset) {
+                return nullptr;
+            }
+
+            bytes -= offset;// NOLINT
         }
 
-        const auto key = fmt::format("{}::{}", enclosing_type_result->get_mangled_type_name(), name);
-        return lookup_named<T, FieldInfo<ET, T>>(key, &*enclosing_type_result, name, offset);
+        const auto* target = detail::lookup_base<std::remove_cv_t<TO>>();
+        const auto offset = target != nullptr ? detail::get_base_offset(type, *target) : invalid_base_offset;
+
+        if(offset == invalid_base_offset) {
+            return nullptr;
+        }
+
+        return reinterpret_cast<Target*>(bytes + offset);// NOLINT
     }
 
     // Reflective instantiation
@@ -216,10 +541,11 @@ namespace kstd::reflect {
         return T {std::forward<ARGS>(args)...};
     }
 
+    // Places the object and its control block into a single pooled slot
     template<typename T, typename... ARGS>
     [[nodiscard]] inline auto make_shared(const TypeInfo<T>&, ARGS&&... args) noexcept -> std::shared_ptr<T> {// NOLINT
         static_assert(std::is_constructible_v<T, ARGS...>, "Type is not constructible with given arguments");
-        return std::make_shared<T, ARGS...>(std::forward<ARGS>(args)...);
+        return std::allocate_shared<T>(PoolAllocator<T> {}, std::forward<ARGS>(args)...);
     }
 
     template<typename T, typename... ARGS>
@@ -227,4 +553,58 @@ namespace kstd::reflect {
         static_assert(std::is_constructible_v<T, ARGS...>, "Type is not constructible with given arguments");
         return std::make_unique<T, ARGS...>(std::forward<ARGS>(args)...);
     }
+
+    // Like make_unique, but places the object into the pool of its type, the slot would leak if construction threw
+    template<typename T, typename... ARGS>
+    [[nodiscard]] inline auto make_pooled(const TypeInfo<T>&, ARGS&&... args) noexcept -> PoolPtr<T> {// NOLINT
+        static_assert(std::is_constructible_v<T, ARGS...>, "Type is not constructible with given arguments");
+        static_assert(std::is_nothrow_constructible_v<T, ARGS...>, "Constructor of pooled type must not throw");
+        return PoolPtr<T> {new(detail::allocate_pooled<sizeof(T), alignof(T)>()) T(std::forward<ARGS>(args)...)};
+    }
+
+    namespace detail {
+        [[nodiscard]] inline auto get_default_lifecycle(const RTTI& type) noexcept -> Result<const TypeLifecycle&> {
+            const auto* lifecycle = type.get_lifecycle();
+
+            if(lifecycle == nullptr) {
+                return Error {fmt::format("{} is not an instantiable type", type.get_type_name())};
+            }
+
+            if(lifecycle->construct == nullptr || lifecycle->destruct == nullptr) {
+                return Error {fmt::format("{} is not nothrow default constructible", type.get_type_name())};
+            }
+
+            return *lifecycle;
+        }
+    }// namespace detail
+
+    /**
+     * Default constructs an instance of the given type in the pool of the type,
+     * for types which are only known at runtime, e.g. by name through the registry.
+     */
+    [[nodiscard]] inline auto make_unique(const RTTI& type) noexcept -> Result<ObjectPtr> {
+        const auto lifecycle_result = detail::get_default_lifecycle(type);
+
+        if(!lifecycle_result) {
+            return lifecycle_result.forward<ObjectPtr>();
+        }
+
+        const auto& lifecycle = *lifecycle_result;
+        auto* object = lifecycle.allocate();
+        lifecycle.construct(object);
+        return ObjectPtr {object, ObjectDeleter {&lifecycle}};
+    }
+
+    // The control block is pooled as well, so no allocation reaches the heap in steady state
+    [[nodiscard]] inline auto make_shared(const RTTI& type) noexcept -> Result<std::shared_ptr<void>> {
+        auto result = make_unique(type);
+
+        if(!result) {
+            return result.forward<std::shared_ptr<void>>();
+        }
+
+        auto& object = *result;
+        const auto deleter = object.get_deleter();
+        return std::shared_ptr<void> {object.release(), deleter, PoolAllocator<u8> {}};
+    }
 }// namespace kstd::reflect
\ No newline at end of file
@@ -19,9 +19,17 @@
 
 #pragma once
 
+#include <kstd/result.hpp>
+
 namespace kstd::reflect {
     struct RTTI;
 
+    class Registry;
+
+    struct TypeLifecycle;
+
+    class TypeHierarchy;
+
     template<typename T>
     struct TypeInfo;
 
@@ -37,6 +45,9 @@ namespace kstd::reflect {
     template<typename ET, typename R, typename... ARGS>
     struct MemberFunctionInfo;
 
+    template<typename ET, typename R, typename... ARGS>
+    struct ConstMemberFunctionInfo;
+
     template<typename T>
     [[nodiscard]] inline auto lookup() noexcept -> Result<const TypeInfo<T>&>;
 }// namespace kstd::reflect
\ No newline at end of file
@@ -0,0 +1,267 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arena.hpp"
+#include "element_type.hpp"
+#include "hash.hpp"
+#include "concurrent_table.hpp"
+#include "reflection_fwd.hpp"
+#include "rtti.hpp"
+#include "string_pool.hpp"
+
+namespace kstd::reflect {
+    /**
+     * Identifies an element in the registry without having to format
+     * its parts into a single string.
+     */
+    struct RegistryKey final {
+        ElementType element_type;
+        std::string_view scope;    // Name of the enclosing type, if any
+        std::string_view name;     // Name of the element itself
+        std::string_view signature;// Type name of the element, if it is named
+
+        [[nodiscard]] constexpr auto hash() const noexcept -> u64 {
+            auto result = static_cast<u64>(element_type);
+            result = hash_combine(result, hash_string(scope));
+            result = hash_combine(result, hash_string(name));
+            return hash_combine(result, hash_string(signature));
+        }
+
+        [[nodiscard]] constexpr auto operator==(const RegistryKey& other) const noexcept -> bool {
+            return element_type == other.element_type && scope == other.scope && name == other.name &&
+                   signature == other.signature;
+        }
+    };
+
+    /**
+     * Destroys RTTI instances either living on the heap or in the arena of
+     * a registry, in which case only the memory is left to the arena.
+     */
+    struct RTTIDeleter final {
+        bool is_arena {false};
+        usize size {0};// Of the most derived type, used for memory accounting
+
+        constexpr RTTIDeleter() noexcept = default;
+
+        constexpr RTTIDeleter(bool is_arena, usize size) noexcept :
+                is_arena {is_arena},
+                size {size} {
+        }
+
+        // Allows passing instances created through std::make_unique
+        template<typename T>
+        constexpr RTTIDeleter(const std::default_delete<T>&) noexcept :// NOLINT
+                size {sizeof(T)} {
+        }
+
+        inline auto operator()(RTTI* value) const noexcept -> void {
+            if(is_arena) {
+                value->~RTTI();
+                return;
+            }
+
+            delete value;// NOLINT
+        }
+    };
+
+    using RTTIPtr = std::unique_ptr<RTTI, RTTIDeleter>;
+
+    /**
+     * Concurrent, append-only registry for all RTTI objects.
+     * Reads of existing entries are lock-free, and exactly one value is
+     * published for every key. Published entries are never moved nor
+     * freed before the registry itself is destroyed, so references handed
+     * out stay valid for the entire lifetime of the registry. Entries and
+     * the values created through create() are placed densely into an arena,
+     * which is released in one go together with the registry.
+     */
+    class Registry final {
+        struct Entry final {
+            u64 hash;
+            RegistryKey key;// All parts are interned
+            RTTIPtr value;
+
+            Entry(u64 hash, const RegistryKey& key, RTTIPtr value) noexcept :
+                    hash {hash},
+                    key {key},
+                    value {std::move(value)} {
+            }
+
+            // The memory of the entry belongs to the arena
+            static inline auto destroy(Entry* entry) noexcept -> void {
+                entry->~Entry();
+            }
+        };
+
+        Arena _arena;// Declared first, so it outlives all entries
+        detail::ConcurrentTable<Entry> _entries;
+        StringPool* _pool {&detail::string_pool};
+
+        [[nodiscard]] inline auto create_entry(const RegistryKey& key, u64 hash, RTTIPtr value) noexcept -> Entry* {
+            value->_hash = hash;// Not published yet, so no other thread can observe this write
+
+            auto& pool = *_pool;
+            const RegistryKey interned_key {key.element_type, pool.intern(key.scope), pool.intern(key.name),
+                                            pool.intern(key.signature)};
+            return _arena.create<Entry>(hash, interned_key, std::move(value));
+        }
+
+        public:
+        struct Insertion final {
+            RegistryKey key;
+            u64 hash;
+            RTTIPtr value;
+            const RTTI* result;// The value published for the key, set by insert_all
+        };
+
+        KSTD_NO_MOVE_COPY(Registry)
+
+        constexpr Registry() noexcept = default;
+
+        // Interns keys into the given pool instead of the shared one, which has to outlive the registry
+        explicit Registry(StringPool& pool) noexcept :
+                _pool {&pool} {
+        }
+
+        ~Registry() noexcept = default;
+
+        [[nodiscard]] inline auto find(const RegistryKey& key) const noexcept -> const RTTI* {
+            return find(key, key.hash());
+        }
+
+        [[nodiscard]] inline auto find(const RegistryKey& key, u64 hash) const noexcept -> const RTTI* {
+            const auto* entry = _entries.find(hash, [&key](const Entry& entry) noexcept {
+                return entry.key == key;
+            });
+            return entry == nullptr ? nullptr : entry->value.get();
+        }
+
+        // Creates a value in the arena of this registry, which can be passed to insert afterwards
+        template<typename RI, typename... ARGS>
+        [[nodiscard]] inline auto create(ARGS&&... args) noexcept -> RTTIPtr {
+            return RTTIPtr {_arena.create<RI>(std::forward<ARGS>(args)...), RTTIDeleter {true, sizeof(RI)}};
+        }
+
+        /**
+         * Publishes the given value under the given key. If another thread
+         * already published a value for the same key, the given value is
+         * discarded and the existing one is returned instead.
+         */
+        inline auto insert(const RegistryKey& key, RTTIPtr value) noexcept -> const RTTI& {
+            return insert(key, key.hash(), std::move(value));
+        }
+
+        inline auto insert(const RegistryKey& key, u64 hash, RTTIPtr value) noexcept -> const RTTI& {
+            auto* entry = create_entry(key, hash, std::move(value));
+            auto* winner = _entries.insert(entry, [&key](const Entry& entry) noexcept {
+                return entry.key == key;
+            });
+
+            if(winner != entry) {
+                Entry::destroy(entry);// We lost the race, discard our instance
+            }
+
+            return *winner->value;
+        }
+
+        /**
+         * Publishes all given values at once, which is considerably cheaper than
+         * inserting them one by one. Values for keys which already have been
+         * published are discarded like with insert.
+         */
+        inline auto insert_all(std::vector<Insertion>& insertions) noexcept -> void {
+            std::vector<Entry*> entries;
+            entries.reserve(insertions.size());
+
+            for(auto& insertion : insertions) {
+                entries.push_back(create_entry(insertion.key, insertion.hash, std::move(insertion.value)));
+            }
+
+            auto winners = entries;
+            _entries.insert_all(winners.data(), winners.size(), [](const Entry& lhs, const Entry& rhs) noexcept {
+                return lhs.key == rhs.key;
+            });
+
+            for(usize index = 0; index < entries.size(); ++index) {
+                if(winners[index] != entries[index]) {
+                    Entry::destroy(entries[index]);
+                }
+
+                insertions[index].result = winners[index]->value.get();
+            }
+        }
+
+        /**
+         * Invokes the given function with the key, the value and the number of bytes
+         * occupied by every published entry. Entries published concurrently may or
+         * may not be visited.
+         */
+        template<typename F>
+        inline auto for_each(F&& function) const noexcept -> void {
+            _entries.for_each([&function](const Entry& entry) {
+                function(entry.key, *entry.value, sizeof(Entry) + entry.value.get_deleter().size);
+            });
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _entries.get_size();
+        }
+
+        // The number of bytes occupied by the hash table, excluding the entries in the arena
+        [[nodiscard]] inline auto get_table_byte_size() const noexcept -> usize {
+            return _entries.get_byte_size();
+        }
+
+        // Grows the table once, so the given number of entries can be inserted without growing it again
+        inline auto reserve(usize size) noexcept -> void {
+            _entries.reserve(size);
+        }
+
+        [[nodiscard]] inline auto get_pool() const noexcept -> StringPool& {
+            return *_pool;
+        }
+
+        [[nodiscard]] inline auto get_arena() const noexcept -> const Arena& {
+            return _arena;
+        }
+    };
+
+    namespace detail {
+        // Constant-initialized, so it is usable from any static initializer
+        inline Registry registry;// NOLINT
+    }// namespace detail
+
+    /**
+     * Retrieves the registry shared by all translation units of the process.
+     */
+    [[nodiscard]] inline auto get_registry() noexcept -> Registry& {
+        return detail::registry;
+    }
+}// namespace kstd::reflect
\ No newline at end of file
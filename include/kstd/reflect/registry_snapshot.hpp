@@ -0,0 +1,419 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if !defined(PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fmt/format.h>
+
+#include "element_type.hpp"
+#include "hash.hpp"
+#include "registry.hpp"
+#include "string_pool.hpp"
+
+namespace kstd::reflect {
+    /**
+     * A snapshot file starts with this header, followed by the string records,
+     * the entry records and the contents of all strings. Records only refer to
+     * each other by index and offset, so the file can be mapped at any address.
+     * Everything is stored in native byte order, snapshots are not portable.
+     */
+    struct SnapshotHeader final {
+        u32 magic;
+        u32 version;
+        u64 fingerprint;// Supplied by the writer, see make_snapshot_fingerprint
+        u64 string_count;
+        u64 entry_count;
+        u64 data_size;// Of all string contents, including their terminators
+    };
+
+    struct SnapshotString final {
+        u64 hash;  // hash_string() of the contents
+        u64 offset;// Relative to the start of the string contents
+        u64 size;  // Excluding the terminator
+    };
+
+    struct SnapshotEntry final {
+        u64 hash;// Of the registry key
+        u32 scope;
+        u32 name;
+        u32 signature;// Indices of string records
+        ElementType element_type;
+    };
+
+    constexpr u32 snapshot_magic = 0x4E53524B;// KRSN
+    constexpr u32 snapshot_version = 1;
+
+    /**
+     * Derives a fingerprint from the given build identifier, e.g. a build ID or
+     * commit hash. Snapshots are only adopted by runs with the same fingerprint.
+     */
+    [[nodiscard]] constexpr auto make_snapshot_fingerprint(std::string_view build_id) noexcept -> u64 {
+        auto result = hash_combine(static_cast<u64>(snapshot_version), static_cast<u64>(sizeof(void*)));
+        return hash_combine(result, hash_string(build_id));
+    }
+
+    namespace detail {
+        constexpr usize snapshot_strings_offset = sizeof(SnapshotHeader);
+
+        [[nodiscard]] constexpr auto get_snapshot_entries_offset(u64 string_count) noexcept -> usize {
+            return snapshot_strings_offset + static_cast<usize>(string_count) * sizeof(SnapshotString);
+        }
+
+        [[nodiscard]] constexpr auto get_snapshot_data_offset(u64 string_count, u64 entry_count) noexcept -> usize {
+            return get_snapshot_entries_offset(string_count) + static_cast<usize>(entry_count) * sizeof(SnapshotEntry);
+        }
+
+        // Read-only view of a file, which is mapped where the platform supports it, open returns its size
+        class MappedFile final {
+            const u8* _data {nullptr};
+            usize _size {0};
+            std::vector<u8> _buffer;// Holds the contents if the file could not be mapped
+
+            public:
+            KSTD_NO_MOVE_COPY(MappedFile)
+
+            MappedFile() noexcept = default;
+
+            ~MappedFile() noexcept {
+#if !defined(PLATFORM_WINDOWS)
+                if(_data != nullptr && _buffer.empty()) {
+                    ::munmap(const_cast<u8*>(_data), _size);// NOLINT
+                }
+#endif
+            }
+
+            [[nodiscard]] inline auto open(const std::string& path) noexcept -> Result<usize> {
+                using namespace std::string_literals;
+#if !defined(PLATFORM_WINDOWS)
+                const auto descriptor = ::open(path.c_str(), O_RDONLY);// NOLINT
+
+                if(descriptor < 0) {
+                    return Error {fmt::format("Could not open {}", path)};
+                }
+
+                struct stat status {};
+
+                if(::fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+                    ::close(descriptor);
+                    return Error {fmt::format("Could not read {}", path)};
+                }
+
+                auto* data = ::mmap(nullptr, static_cast<usize>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+                ::close(descriptor);
+
+                if(data == MAP_FAILED) {// NOLINT
+                    return Error {fmt::format("Could not map {}", path)};
+                }
+
+                _data = static_cast<const u8*>(data);
+                _size = static_cast<usize>(status.st_size);
+                return _size;
+#else
+                auto* file = std::fopen(path.c_str(), "rb");// NOLINT
+
+                if(file == nullptr) {
+                    return Error {fmt::format("Could not open {}", path)};
+                }
+
+                u8 chunk[4096];// NOLINT
+
+                for(auto count = std::fread(chunk, 1, sizeof(chunk), file); count > 0;
+                    count = std::fread(chunk, 1, sizeof(chunk), file)) {
+                    _buffer.insert(_buffer.end(), chunk, chunk + count);// NOLINT
+                }
+
+                std::fclose(file);
+
+                if(_buffer.empty()) {
+                    return Error {fmt::format("Could not read {}", path)};
+                }
+
+                _data = _buffer.data();
+                _size = _buffer.size();
+                return _size;
+#endif
+            }
+
+            [[nodiscard]] inline auto get_data() const noexcept -> const u8* {
+                return _data;
+            }
+
+            [[nodiscard]] inline auto get_size() const noexcept -> usize {
+                return _size;
+            }
+        };
+    }// namespace detail
+
+    /**
+     * Writes the keys of all entries of the given registry and every string of
+     * its pool into a snapshot, which a later run can map and adopt instead of
+     * interning the same strings and growing the same tables again.
+     */
+    [[nodiscard]] inline auto write_snapshot(const Registry& registry, u64 fingerprint) noexcept -> std::vector<u8> {
+        std::vector<SnapshotString> strings;
+        std::vector<SnapshotEntry> entries;
+        std::unordered_map<std::string_view, u32> indices;
+        std::string data;
+
+        const auto add_string = [&](std::string_view value, u64 hash) -> u32 {
+            const auto [index, is_new] = indices.emplace(value, static_cast<u32>(strings.size()));
+
+            if(is_new) {
+                strings.push_back({hash, data.size(), value.size()});
+                data.append(value);
+                data.push_back('\0');
+            }
+
+            return index->second;
+        };
+
+        registry.get_pool().for_each(add_string);
+        registry.for_each([&](const RegistryKey& key, const RTTI&, usize) {// NOLINT
+            entries.push_back({key.hash(), add_string(key.scope, hash_string(key.scope)),
+                               add_string(key.name, hash_string(key.name)),
+                               add_string(key.signature, hash_string(key.signature)), key.element_type});
+        });
+
+        const SnapshotHeader header {snapshot_magic, snapshot_version, fingerprint, strings.size(), entries.size(),
+                                     data.size()};
+        const auto data_offset = detail::get_snapshot_data_offset(strings.size(), entries.size());
+        std::vector<u8> buffer(data_offset + data.size());
+        std::memcpy(buffer.data(), &header, sizeof(SnapshotHeader));
+
+        if(!strings.empty()) {
+            std::memcpy(buffer.data() + detail::snapshot_strings_offset, strings.data(),
+                        strings.size() * sizeof(SnapshotString));
+        }
+
+        if(!entries.empty()) {
+            std::memcpy(buffer.data() + detail::get_snapshot_entries_offset(strings.size()), entries.data(),
+                        entries.size() * sizeof(SnapshotEntry));
+        }
+
+        std::memcpy(buffer.data() + data_offset, data.data(), data.size());
+        return buffer;
+    }
+
+    [[nodiscard]] inline auto save_snapshot(const Registry& registry, u64 fingerprint,
+                                            const std::string& path) noexcept -> Result<usize> {
+        const auto buffer = write_snapshot(registry, fingerprint);
+        auto* file = std::fopen(path.c_str(), "wb");// NOLINT
+
+        if(file == nullptr) {
+            return Error {fmt::format("Could not open {}", path)};
+        }
+
+        const auto written = std::fwrite(buffer.data(), 1, buffer.size(), file);
+        const auto is_closed = std::fclose(file) == 0;
+
+        if(written != buffer.size() || !is_closed) {
+            return Error {fmt::format("Could not write {}", path)};
+        }
+
+        return buffer.size();
+    }
+
+    /**
+     * A validated snapshot, mapped read-only into memory. Adopting it interns its
+     * strings without copying them and sizes the tables of a registry and its pool
+     * up front. The RTTI instances themselves are not part of the snapshot, they
+     * are still created on their first lookup and find their keys already interned.
+     * Interned strings point into the mapping, so the snapshot has to outlive every
+     * registry and pool it was adopted into.
+     */
+    class RegistrySnapshot final {
+        detail::MappedFile _file;
+        SnapshotHeader _header {};
+
+        // Returns the number of entries
+        [[nodiscard]] inline auto validate(u64 fingerprint) noexcept -> Result<usize> {
+            using namespace std::string_literals;
+            const auto size = _file.get_size();
+
+            if(size < sizeof(SnapshotHeader)) {
+                return Error {"Snapshot is too small"s};
+            }
+
+            std::memcpy(&_header, _file.get_data(), sizeof(SnapshotHeader));
+
+            if(_header.magic != snapshot_magic || _header.version != snapshot_version) {
+                return Error {"File is not a snapshot of this version"s};
+            }
+
+            if(_header.fingerprint != fingerprint) {
+                return Error {"Snapshot was written by a different build"s};
+            }
+
+            // Bound the counts first, so computing the offsets below cannot overflow
+            if(_header.string_count > size || _header.entry_count > size ||
+               detail::get_snapshot_data_offset(_header.string_count, _header.entry_count) > size ||
+               _header.data_size != size - detail::get_snapshot_data_offset(_header.string_count, _header.entry_count)) {
+                return Error {"Snapshot is truncated"s};
+            }
+
+            const auto* data = get_string_data();
+
+            for(u64 index = 0; index < _header.string_count; ++index) {
+                const auto string = get_string(index);
+
+                if(string.offset >= _header.data_size || string.size >= _header.data_size - string.offset ||
+                   data[string.offset + string.size] != '\0') {// NOLINT
+                    return Error {"Snapshot contains an invalid string"s};
+                }
+            }
+
+            for(u64 index = 0; index < _header.entry_count; ++index) {
+                const auto entry = get_entry(index);
+
+                if(entry.scope >= _header.string_count || entry.name >= _header.string_count ||
+                   entry.signature >= _header.string_count || entry.element_type > ElementType::MEMBER_FUNCTION) {
+                    return Error {"Snapshot contains an invalid entry"s};
+                }
+            }
+
+            return static_cast<usize>(_header.entry_count);
+        }
+
+        [[nodiscard]] inline auto get_string_data() const noexcept -> const char* {
+            return reinterpret_cast<const char*>(_file.get_data() +// NOLINT
+                                                 detail::get_snapshot_data_offset(_header.string_count,
+                                                                                  _header.entry_count));
+        }
+
+        // Records are copied out, the mapping only guarantees the alignment of its start
+        [[nodiscard]] inline auto get_string(u64 index) const noexcept -> SnapshotString {
+            SnapshotString string {};
+            std::memcpy(&string, _file.get_data() + detail::snapshot_strings_offset + index * sizeof(SnapshotString),
+                        sizeof(SnapshotString));// NOLINT
+            return string;
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(RegistrySnapshot)
+
+        RegistrySnapshot() noexcept = default;
+
+        ~RegistrySnapshot() noexcept = default;
+
+        // Maps the given file and checks its structure and fingerprint
+        [[nodiscard]] static inline auto open(const std::string& path, u64 fingerprint) noexcept
+                -> Result<std::unique_ptr<RegistrySnapshot>> {
+            auto snapshot = std::make_unique<RegistrySnapshot>();
+
+            if(auto result = snapshot->_file.open(path); !result) {
+                return result.template forward<std::unique_ptr<RegistrySnapshot>>();
+            }
+
+            if(auto result = snapshot->validate(fingerprint); !result) {
+                return result.template forward<std::unique_ptr<RegistrySnapshot>>();
+            }
+
+            return snapshot;
+        }
+
+        [[nodiscard]] inline auto get_header() const noexcept -> const SnapshotHeader& {
+            return _header;
+        }
+
+        [[nodiscard]] inline auto get_string_count() const noexcept -> usize {
+            return static_cast<usize>(_header.string_count);
+        }
+
+        [[nodiscard]] inline auto get_entry_count() const noexcept -> usize {
+            return static_cast<usize>(_header.entry_count);
+        }
+
+        [[nodiscard]] inline auto get_string_value(u64 index) const noexcept -> std::string_view {
+            const auto string = get_string(index);
+            return {get_string_data() + string.offset, static_cast<usize>(string.size)};// NOLINT
+        }
+
+        [[nodiscard]] inline auto get_entry(u64 index) const noexcept -> SnapshotEntry {
+            SnapshotEntry entry {};
+            std::memcpy(&entry,
+                        _file.get_data() + detail::get_snapshot_entries_offset(_header.string_count) +// NOLINT
+                                index * sizeof(SnapshotEntry),
+                        sizeof(SnapshotEntry));
+            return entry;
+        }
+
+        // The key of the given entry, whose parts point into the mapping
+        [[nodiscard]] inline auto get_key(u64 index) const noexcept -> RegistryKey {
+            const auto entry = get_entry(index);
+            return {entry.element_type, get_string_value(entry.scope), get_string_value(entry.name),
+                    get_string_value(entry.signature)};
+        }
+
+        /**
+         * Interns all strings of this snapshot into the pool of the given registry
+         * and reserves room for all of its entries. Returns the number of strings
+         * which were not interned before.
+         */
+        inline auto adopt(Registry& registry) const noexcept -> usize {
+            auto& pool = registry.get_pool();
+            const auto previous_size = pool.get_size();
+            pool.reserve(previous_size + get_string_count());
+
+            for(u64 index = 0; index < _header.string_count; ++index) {
+                const auto string = get_string(index);
+                (void) pool.intern_static({get_string_data() + string.offset, static_cast<usize>(string.size)},// NOLINT
+                                          string.hash);
+            }
+
+            registry.reserve(registry.get_size() + get_entry_count());
+            return pool.get_size() - previous_size;
+        }
+    };
+
+    /**
+     * Adopts the snapshot at the given path into the shared registry. The snapshot
+     * stays mapped until the process exits, since interned strings point into it.
+     */
+    [[nodiscard]] inline auto adopt_snapshot(const std::string& path, u64 fingerprint) noexcept -> Result<usize> {
+        auto snapshot_result = RegistrySnapshot::open(path, fingerprint);
+
+        if(!snapshot_result) {
+            return snapshot_result.template forward<usize>();
+        }
+
+        const auto* snapshot = snapshot_result->release();// Deliberately never unmapped
+        return snapshot->adopt(get_registry());
+    }
+}// namespace kstd::reflect
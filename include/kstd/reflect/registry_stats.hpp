@@ -0,0 +1,90 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+
+#include <array>
+
+#include "element_type.hpp"
+#include "registry.hpp"
+#include "stat_counters.hpp"
+#include "string_pool.hpp"
+
+namespace kstd::reflect {
+    inline constexpr usize element_type_count = static_cast<usize>(ElementType::MEMBER_FUNCTION) + 1;
+
+    struct ElementStats final {
+        usize count;
+        usize byte_size;// Entries and values, excluding interned strings
+    };
+
+    /**
+     * Point-in-time view of what the shared registry costs. Entry counts and
+     * sizes are always available, the counters stay 0 unless the library is
+     * compiled with KSTD_REFLECT_ENABLE_STATS.
+     */
+    struct RegistryStats final {
+        std::array<u64, stat_counter_count> counters;
+        std::array<ElementStats, element_type_count> elements;
+        usize entry_count;
+        usize table_byte_size;
+        usize arena_byte_size;
+        usize string_count;
+        usize string_byte_size;
+
+        [[nodiscard]] inline auto get_counter(StatCounter counter) const noexcept -> u64 {
+            return counters[static_cast<usize>(counter)];
+        }
+
+        [[nodiscard]] inline auto get_elements(ElementType element_type) const noexcept -> const ElementStats& {
+            return elements[static_cast<usize>(element_type)];
+        }
+    };
+
+    /**
+     * Takes a snapshot of the counters and walks the shared registry once,
+     * so this is meant for diagnostics rather than hot paths.
+     */
+    [[nodiscard]] inline auto registry_stats() noexcept -> RegistryStats {
+        RegistryStats stats {};
+
+        for(usize index = 0; index < stat_counter_count; ++index) {
+            stats.counters[index] = detail::get_counter(static_cast<StatCounter>(index));
+        }
+
+        const auto& registry = get_registry();
+        registry.for_each([&stats](const RegistryKey& key, const RTTI&, usize byte_size) {// NOLINT
+            auto& elements = stats.elements[static_cast<usize>(key.element_type)];
+            ++elements.count;
+            elements.byte_size += byte_size;
+        });
+
+        stats.entry_count = registry.get_size();
+        stats.table_byte_size = registry.get_table_byte_size();
+        stats.arena_byte_size = registry.get_arena().get_byte_size();
+
+        const auto& pool = get_string_pool();
+        stats.string_count = pool.get_size();
+        stats.string_byte_size = pool.get_byte_size();
+        return stats;
+    }
+}// namespace kstd::reflect
@@ -21,29 +21,88 @@
 
 #include <kstd/defaults.hpp>
 #include <kstd/result.hpp>
+#include <kstd/types.hpp>
 #include <string>
+#include <string_view>
 
 #include "element_type.hpp"
 #include "reflection_fwd.hpp"
+#include "type_traits.hpp"
 
 namespace kstd::reflect {
     struct RTTI {
+        friend class Registry;
+
+        private:
+        u64 _hash {0};// Assigned by the registry before the instance is published
+        TypeTraits _traits {};
+
+        protected:
+        explicit RTTI(const TypeTraits& traits) noexcept :
+                _traits {traits} {
+        }
+
+        public:
         KSTD_DEFAULT_MOVE_COPY(RTTI, RTTI)
 
         RTTI() noexcept = default;
 
         virtual ~RTTI() noexcept = default;
 
-        [[nodiscard]] virtual auto get_mangled_type_name() const noexcept -> const std::string& = 0;
+        [[nodiscard]] virtual auto get_mangled_type_name() const noexcept -> std::string_view = 0;
 
-        [[nodiscard, maybe_unused]] virtual auto get_type_name() const noexcept -> const std::string& = 0;
+        [[nodiscard, maybe_unused]] virtual auto get_type_name() const noexcept -> std::string_view = 0;
 
         [[nodiscard]] virtual auto get_element_type() const noexcept -> ElementType = 0;
 
-        [[nodiscard]] virtual auto is_same(const RTTI& other) const noexcept -> bool = 0;
+        /**
+         * Registered instances are unique within their registry, so identity decides
+         * the common case. Instances from different registries (e.g. one per shared
+         * library) only fall back to a structural compare if their key hashes match.
+         */
+        [[nodiscard]] inline auto is_same(const RTTI& other) const noexcept -> bool {
+            if(this == &other) {
+                return true;
+            }
+            return _hash == other._hash && is_equivalent(other);
+        }
+
+        /**
+         * The hash of the key this instance was registered under, which is
+         * stable for the lifetime of the registry and 0 for unregistered instances.
+         */
+        [[nodiscard]] inline auto get_hash() const noexcept -> u64 {
+            return _hash;
+        }
+
+        // Allows creating instances of reflected types at runtime, null for every other element
+        [[nodiscard]] virtual auto get_lifecycle() const noexcept -> const TypeLifecycle* {
+            return nullptr;
+        }
+
+        // The registered bases of the described class type, null for every other element
+        [[nodiscard]] virtual auto get_hierarchy() const noexcept -> const TypeHierarchy* {
+            return nullptr;
+        }
+
+        /**
+         * Whether the described type is the given type or derives from it through
+         * bases registered with KSTD_REFLECT_BASES, in constant time.
+         */
+        [[nodiscard]] virtual auto is_derived_from(const RTTI& other) const noexcept -> bool {
+            return is_same(other);
+        }
+
+        /**
+         * The traits of the described type, which are filled in once on creation.
+         * Variables and fields report the traits of their type.
+         */
+        [[nodiscard]] inline auto get_traits() const noexcept -> const TypeTraits& {
+            return _traits;
+        }
 
         [[nodiscard]] virtual auto to_string() const noexcept -> std::string {
-            return get_mangled_type_name();// Copy
+            return std::string {get_mangled_type_name()};
         }
 
         template<typename T>
@@ -74,12 +133,12 @@ namespace kstd::reflect {
             return static_cast<const FieldInfo<ET, T>&>(*this);// NOLINT
         }
 
+        // Member functions can only be invoked on an instance, use as_member_function for them
         template<typename R, typename... ARGS>
         [[nodiscard]] inline auto as_function() const noexcept -> Result<const FunctionInfo<R, ARGS...>&> {
             using namespace std::string_literals;
-            const auto type = get_element_type();
 
-            if(type != ElementType::FUNCTION && type != ElementType::MEMBER_FUNCTION) {
+            if(get_element_type() != ElementType::FUNCTION) {
                 return Error {"Invalid element type"s};
             }
 
@@ -101,5 +160,8 @@ namespace kstd::reflect {
         [[nodiscard]] inline auto operator==(const RTTI& other) const noexcept -> bool {
             return is_same(other);
         }
+
+        protected:
+        [[nodiscard]] virtual auto is_equivalent(const RTTI& other) const noexcept -> bool = 0;
     };
 }// namespace kstd::reflect
\ No newline at end of file
@@ -54,6 +54,6 @@ namespace kstd::reflect {
 template<>
 struct std::hash<kstd::reflect::RTTIRef> final {
     auto operator()(kstd::reflect::RTTIRef const& value) const noexcept -> std::size_t {
-        return std::hash<std::string> {}((*value).to_string());
+        return static_cast<std::size_t>((*value).get_hash());
     }
 };
\ No newline at end of file
@@ -0,0 +1,314 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#pragma once
+
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "reflection.hpp"
+
+namespace kstd::reflect {
+    /**
+     * Every serialized record starts with this header, followed by a memory image
+     * of the reflected fields and the contents of all container fields. Container
+     * fields are replaced by a SerialBlob in the memory image. Records are stored
+     * in native byte order and padded to serial_alignment, so a buffer of records
+     * which starts out aligned stays aligned for every record in it.
+     */
+    struct SerialHeader final {
+        u32 magic;
+        u32 fixed_size;// sizeof the serialized type
+        u64 layout_hash;
+        u64 variable_size;
+        u64 size;// Of the entire record including this header
+    };
+
+    // Location of the contents of a container field relative to the start of its record
+    struct SerialBlob final {
+        u64 offset;
+        u64 size;
+    };
+
+    static_assert(sizeof(SerialBlob) == detail::byte_container_slot_size, "Blobs must fit into byte containers");
+
+    constexpr u32 serial_magic = 0x4652534B;// KSRF
+    constexpr usize serial_alignment = 16;
+
+    namespace detail {
+        template<typename T>
+        struct IsBasicString : std::false_type {};
+
+        template<typename C, typename TRAITS, typename ALLOCATOR>
+        struct IsBasicString<std::basic_string<C, TRAITS, ALLOCATOR>> : std::true_type {};
+
+        [[nodiscard]] constexpr auto align_up(usize value, usize alignment) noexcept -> usize {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        constexpr usize serial_fixed_offset = sizeof(SerialHeader);
+        static_assert(serial_fixed_offset % serial_alignment == 0, "Header breaks the alignment of records");
+
+        template<typename T>
+        constexpr usize serial_variable_offset = sizeof(SerialHeader) + align_up(sizeof(T), serial_alignment);
+
+        template<typename T>
+        [[nodiscard]] inline auto get_serial_layout() noexcept -> Result<const TypeLayout&> {
+            using namespace std::string_literals;
+            static_assert(alignof(T) <= serial_alignment, "Type is over-aligned");
+            const auto type_result = lookup<T>();
+
+            if(!type_result) {
+                return type_result.template forward<const TypeLayout&>();
+            }
+
+            // The current layout grows with every field lookup, the declared one is fixed
+            const auto* declared = layout_slot<T>.get_declared();
+
+            if(declared == nullptr) {
+                return Error {"Type has to be reflected using KSTD_REFLECT_STRUCT"s};
+            }
+
+            const auto& layout = *declared;
+
+            if(layout.get_fields().empty()) {
+                return Error {"Type has no reflected fields"s};
+            }
+
+            if(!layout.is_serializable()) {
+                return Error {"Type has fields which cannot be serialized"s};
+            }
+
+            return layout;
+        }
+
+        // Checks the header and the bounds of every blob, so records can be accessed without further checks
+        template<typename T>
+        [[nodiscard]] inline auto validate_record(const TypeLayout& layout, const u8* record, usize size) noexcept
+                -> Result<SerialHeader> {
+            using namespace std::string_literals;
+
+            if(size < serial_variable_offset<T>) {
+                return Error {"Buffer is too small"s};
+            }
+
+            SerialHeader header {};
+            std::memcpy(&header, record, sizeof(SerialHeader));
+
+            if(header.magic != serial_magic || header.fixed_size != sizeof(T)) {
+                return Error {"Buffer does not contain a record of the given type"s};
+            }
+
+            if(header.layout_hash != layout.get_hash()) {
+                return Error {"Record was written with a different layout"s};
+            }
+
+            if(header.size > size || header.size < serial_variable_offset<T> + header.variable_size) {
+                return Error {"Record is truncated"s};
+            }
+
+            for(const auto& field : layout.get_fields()) {
+                if(field.get_bytes == nullptr) {
+                    continue;
+                }
+
+                SerialBlob blob {};
+                std::memcpy(&blob, record + serial_fixed_offset + field.offset, sizeof(SerialBlob));// NOLINT
+
+                if(blob.offset < serial_variable_offset<T> || blob.offset > header.size ||
+                   blob.size > header.size - blob.offset) {
+                    return Error {"Record contains an invalid blob"s};
+                }
+            }
+
+            return header;
+        }
+    }// namespace detail
+
+    /**
+     * Appends the reflected fields of the given value to the given buffer and returns
+     * the number of bytes written. Only the fields declared with KSTD_REFLECT_STRUCT are
+     * written, fields which are looked up later on do not change the record layout.
+     * Pointers and containers of pointers cannot be serialized.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto serialize(const T& value, std::vector<u8>& buffer) noexcept -> Result<usize> {
+        const auto layout_result = detail::get_serial_layout<T>();
+
+        if(!layout_result) {
+            return layout_result.template forward<usize>();
+        }
+
+        const auto& layout = *layout_result;
+        const auto* source = reinterpret_cast<const u8*>(&value);// NOLINT
+        usize variable_size = 0;
+
+        for(const auto& field : layout.get_fields()) {
+            if(field.get_bytes != nullptr) {
+                usize size = 0;
+                (void) field.get_bytes(source + field.offset, size);// NOLINT
+                variable_size += detail::align_up(size, serial_alignment);
+            }
+        }
+
+        const SerialHeader header {serial_magic, static_cast<u32>(sizeof(T)), layout.get_hash(), variable_size,
+                                   detail::serial_variable_offset<T> + variable_size};
+        const auto start = buffer.size();
+        buffer.resize(start + header.size);
+        auto* record = buffer.data() + start;      // NOLINT
+        auto* fixed = record + sizeof(SerialHeader);// NOLINT
+        std::memcpy(record, &header, sizeof(SerialHeader));
+
+        for(const auto& span : layout.get_copy_spans()) {
+            std::memcpy(fixed + span.offset, source + span.offset, span.size);// NOLINT
+        }
+
+        auto offset = detail::serial_variable_offset<T>;
+
+        for(const auto& field : layout.get_fields()) {
+            if(field.get_bytes == nullptr) {
+                continue;
+            }
+
+            usize size = 0;
+            const auto* data = field.get_bytes(source + field.offset, size);// NOLINT
+
+            if(size > 0) {
+                std::memcpy(record + offset, data, size);// NOLINT
+            }
+
+            // Every byte container can hold a blob, make_field_layout asserts that
+            const SerialBlob blob {offset, size};
+            std::memcpy(fixed + field.offset, &blob, sizeof(SerialBlob));// NOLINT
+            offset += detail::align_up(size, serial_alignment);
+        }
+
+        return header.size;
+    }
+
+    // Reads a record written by serialize into the given value and returns the number of bytes consumed
+    template<typename T>
+    [[nodiscard]] inline auto deserialize(const void* data, usize size, T& value) noexcept -> Result<usize> {
+        const auto layout_result = detail::get_serial_layout<T>();
+
+        if(!layout_result) {
+            return layout_result.template forward<usize>();
+        }
+
+        const auto& layout = *layout_result;
+        const auto* record = static_cast<const u8*>(data);
+        const auto header_result = detail::validate_record<T>(layout, record, size);
+
+        if(!header_result) {
+            return header_result.template forward<usize>();
+        }
+
+        auto* destination = reinterpret_cast<u8*>(&value);      // NOLINT
+        const auto* fixed = record + detail::serial_fixed_offset;// NOLINT
+
+        for(const auto& span : layout.get_copy_spans()) {
+            std::memcpy(destination + span.offset, fixed + span.offset, span.size);// NOLINT
+        }
+
+        for(const auto& field : layout.get_fields()) {
+            if(field.set_bytes == nullptr) {
+                continue;
+            }
+
+            SerialBlob blob {};
+            std::memcpy(&blob, fixed + field.offset, sizeof(SerialBlob));                          // NOLINT
+            field.set_bytes(destination + field.offset, record + blob.offset, static_cast<usize>(blob.size));// NOLINT
+        }
+
+        return header_result->size;
+    }
+
+    /**
+     * Resolves the fields of a serialized record in place, without deserializing it.
+     * The underlying buffer, e.g. a memory mapped file, has to outlive the view and be
+     * aligned to serial_alignment. String fields are returned as views into the buffer.
+     */
+    template<typename T>
+    class SerialView final {
+        const u8* _record;
+        usize _size;
+
+        SerialView(const u8* record, usize size) noexcept :
+                _record {record},
+                _size {size} {
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(SerialView, SerialView)
+
+        ~SerialView() noexcept = default;
+
+        [[nodiscard]] static inline auto create(const void* data, usize size) noexcept -> Result<SerialView> {
+            using namespace std::string_literals;
+            const auto layout_result = detail::get_serial_layout<T>();
+
+            if(!layout_result) {
+                return layout_result.template forward<SerialView>();
+            }
+
+            if(reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0) {// NOLINT
+                return Error {"Buffer is not sufficiently aligned"s};
+            }
+
+            const auto* record = static_cast<const u8*>(data);
+            const auto header_result = detail::validate_record<T>(*layout_result, record, size);
+
+            if(!header_result) {
+                return header_result.template forward<SerialView>();
+            }
+
+            return SerialView {record, static_cast<usize>(header_result->size)};
+        }
+
+        // The size of the record, which is also the offset of the next record in the same buffer
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        template<typename FT>
+        [[nodiscard]] inline auto get(const FieldInfo<T, FT>& field) const noexcept -> decltype(auto) {
+            const auto* address = _record + detail::serial_fixed_offset + field.get_offset();// NOLINT
+
+            if constexpr(detail::is_bulk_copyable_v<FT>) {
+                return *reinterpret_cast<const FT*>(address);// NOLINT
+            }
+            else {
+                static_assert(detail::IsBasicString<FT>::value, "Field type cannot be viewed in place");
+                using Char = typename FT::value_type;
+                SerialBlob blob {};
+                std::memcpy(&blob, address, sizeof(SerialBlob));
+                return std::basic_string_view<Char> {reinterpret_cast<const Char*>(_record + blob.offset),// NOLINT
+                                                     static_cast<usize>(blob.size / sizeof(Char))};
+            }
+        }
+    };
+}// namespace kstd::reflect
\ No newline at end of file
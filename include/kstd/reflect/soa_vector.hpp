@@ -0,0 +1,340 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "static_reflection.hpp"
+
+namespace kstd::reflect {
+    // Columns start on a cache line, which also satisfies the alignment of the widest SIMD registers
+    inline constexpr usize soa_alignment = 64;
+
+    namespace detail {
+        template<typename T>
+        [[nodiscard]] constexpr auto get_column_alignment() noexcept -> usize {
+            return std::max(soa_alignment, alignof(T));
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto allocate_column(usize capacity) noexcept -> T* {
+            return static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t {get_column_alignment<T>()}));
+        }
+
+        template<typename T>
+        inline auto free_column(T* column) noexcept -> void {
+            ::operator delete(column, std::align_val_t {get_column_alignment<T>()});
+        }
+
+        // Moves count elements into uninitialized storage and destroys the source elements
+        template<typename T>
+        inline auto relocate_column(T* destination, T* source, usize count) noexcept -> void {
+            if constexpr(std::is_trivially_copyable_v<T>) {
+                if(count > 0) {
+                    std::memcpy(destination, source, count * sizeof(T));
+                }
+            }
+            else {
+                for(usize index = 0; index < count; ++index) {
+                    new(destination + index) T(std::move(source[index]));// NOLINT
+                    source[index].~T();                                  // NOLINT
+                }
+            }
+        }
+
+        template<typename T>
+        inline auto destroy_column(T* column, usize begin, usize end) noexcept -> void {
+            if constexpr(!std::is_trivially_destructible_v<T>) {
+                for(usize index = begin; index < end; ++index) {
+                    column[index].~T();// NOLINT
+                }
+            }
+        }
+
+        template<typename FIELDS>
+        struct SoAColumns;
+
+        template<typename... FIELDS>
+        struct SoAColumns<std::tuple<FIELDS...>> final {
+            // Columns hold copies of the fields, so they stay assignable even for const fields
+            using Type = std::tuple<std::remove_cv_t<typename FIELDS::Type>*...>;
+
+            // Loading assigns every field of an existing object, which const fields do not allow
+            static constexpr bool is_loadable = (std::is_copy_assignable_v<typename FIELDS::Type> && ...);
+        };
+    }// namespace detail
+
+    /**
+     * Stores every field of the static field list of T in its own contiguous
+     * column, aligned for SIMD loads. Loops which only touch a few fields
+     * scan the respective columns instead of streaming whole objects through
+     * the cache. Fields missing from the static field list are not stored.
+     */
+    template<typename T>
+    class SoAVector final {
+        using Fields = std::decay_t<decltype(static_field_list<T>)>;
+        using Columns = typename detail::SoAColumns<Fields>::Type;
+
+        static constexpr usize field_count = std::tuple_size_v<Fields>;
+        static constexpr usize initial_capacity = 16;
+
+        static_assert(field_count > 0, "Type has no static field list, use KSTD_STATIC_REFLECT_STRUCT");
+
+        Columns _columns {};
+        usize _size {0};
+        usize _capacity {0};
+
+        template<typename F>
+        inline auto for_each_column(F&& function) noexcept -> void {
+            std::apply(
+                    [&function](auto*&... columns) {
+                        (function(columns), ...);
+                    },
+                    _columns);
+        }
+
+        // Invokes the given function with every field and its column
+        template<typename F, usize... INDICES>
+        inline auto for_each_field(F&& function, std::index_sequence<INDICES...>) const noexcept -> void {
+            (function(std::get<INDICES>(static_field_list<T>), std::get<INDICES>(_columns)), ...);
+        }
+
+        template<typename F>
+        inline auto for_each_field(F&& function) const noexcept -> void {
+            for_each_field(std::forward<F>(function), std::make_index_sequence<field_count> {});
+        }
+
+        inline auto grow(usize capacity) noexcept -> void {
+            for_each_column([this, capacity](auto*& column) {
+                using Element = std::remove_reference_t<decltype(*column)>;
+                auto* new_column = detail::allocate_column<Element>(capacity);
+
+                if(column != nullptr) {
+                    detail::relocate_column(new_column, column, _size);
+                    detail::free_column(column);
+                }
+
+                column = new_column;
+            });
+
+            _capacity = capacity;
+        }
+
+        inline auto release() noexcept -> void {
+            clear();
+
+            for_each_column([](auto*& column) {
+                if(column != nullptr) {
+                    detail::free_column(column);
+                    column = nullptr;
+                }
+            });
+
+            _capacity = 0;
+        }
+
+        public:
+        using ValueType = T;
+
+        // Proxy for the fields of a single element, spread across all columns
+        template<bool IS_CONST>
+        class BasicRow final {
+            using Vector = std::conditional_t<IS_CONST, const SoAVector, SoAVector>;
+
+            Vector* _vector;
+            usize _index;
+
+            public:
+            BasicRow(Vector* vector, usize index) noexcept :
+                    _vector {vector},
+                    _index {index} {
+            }
+
+            [[nodiscard]] inline auto get_index() const noexcept -> usize {
+                return _index;
+            }
+
+            template<usize INDEX>
+            [[nodiscard]] inline auto get() const noexcept -> decltype(auto) {
+                return _vector->template get_column<INDEX>()[_index];// NOLINT
+            }
+
+            // Assembles a copy of the element, fields missing from the static field list are default initialized
+            [[nodiscard]] inline auto load() const noexcept -> ValueType {
+                return _vector->load(_index);
+            }
+
+            template<bool C = IS_CONST, typename = std::enable_if_t<!C>>
+            inline auto store(const ValueType& value) const noexcept -> void {
+                _vector->store(_index, value);
+            }
+        };
+
+        using Row = BasicRow<false>;
+        using ConstRow = BasicRow<true>;
+
+        SoAVector() noexcept = default;
+
+        explicit SoAVector(usize size) noexcept {
+            resize(size);
+        }
+
+        SoAVector(const SoAVector&) = delete;
+
+        SoAVector(SoAVector&& other) noexcept :
+                _columns {std::exchange(other._columns, Columns {})},
+                _size {std::exchange(other._size, 0)},
+                _capacity {std::exchange(other._capacity, 0)} {
+        }
+
+        ~SoAVector() noexcept {
+            release();
+        }
+
+        auto operator=(const SoAVector&) -> SoAVector& = delete;
+
+        auto operator=(SoAVector&& other) noexcept -> SoAVector& {
+            if(this != &other) {
+                release();
+                _columns = std::exchange(other._columns, Columns {});
+                _size = std::exchange(other._size, 0);
+                _capacity = std::exchange(other._capacity, 0);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _size;
+        }
+
+        [[nodiscard]] inline auto get_capacity() const noexcept -> usize {
+            return _capacity;
+        }
+
+        [[nodiscard]] inline auto is_empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        [[nodiscard]] static constexpr auto get_column_count() noexcept -> usize {
+            return field_count;
+        }
+
+        // The column of the field at the given index of the static field list
+        template<usize INDEX>
+        [[nodiscard]] inline auto get_column() noexcept {
+            return std::get<INDEX>(_columns);
+        }
+
+        template<usize INDEX>
+        [[nodiscard]] inline auto get_column() const noexcept {
+            return static_cast<const std::remove_pointer_t<std::tuple_element_t<INDEX, Columns>>*>(
+                    std::get<INDEX>(_columns));
+        }
+
+        inline auto reserve(usize capacity) noexcept -> void {
+            if(capacity > _capacity) {
+                grow(capacity);
+            }
+        }
+
+        // New elements are value initialized
+        inline auto resize(usize size) noexcept -> void {
+            if(size < _size) {
+                for_each_column([this, size](auto* column) {
+                    detail::destroy_column(column, size, _size);
+                });
+                _size = size;
+                return;
+            }
+
+            reserve(size);
+
+            for_each_column([this, size](auto* column) {
+                using Element = std::remove_reference_t<decltype(*column)>;
+
+                for(usize index = _size; index < size; ++index) {
+                    new(column + index) Element();// NOLINT
+                }
+            });
+
+            _size = size;
+        }
+
+        inline auto clear() noexcept -> void {
+            resize(0);
+        }
+
+        inline auto push_back(const ValueType& value) noexcept -> void {
+            if(_size == _capacity) {
+                grow(_capacity == 0 ? initial_capacity : _capacity << 1U);
+            }
+
+            for_each_field([this, &value](const auto& field, auto* column) {
+                using Element = typename std::decay_t<decltype(field)>::Type;
+                new(column + _size) Element(field.get(value));// NOLINT
+            });
+
+            ++_size;
+        }
+
+        inline auto pop_back() noexcept -> void {
+            for_each_column([this](auto* column) {
+                detail::destroy_column(column, _size - 1, _size);
+            });
+
+            --_size;
+        }
+
+        [[nodiscard]] inline auto load(usize index) const noexcept -> ValueType {
+            static_assert(std::is_default_constructible_v<ValueType>, "Type must be default constructible to be loaded");
+            static_assert(detail::SoAColumns<Fields>::is_loadable, "Fields must not be const to be loaded");
+            ValueType result {};
+
+            for_each_field([&result, index](const auto& field, const auto* column) {
+                field.set(result, column[index]);// NOLINT
+            });
+
+            return result;
+        }
+
+        inline auto store(usize index, const ValueType& value) noexcept -> void {
+            for_each_field([&value, index](const auto& field, auto* column) {
+                column[index] = field.get(value);// NOLINT
+            });
+        }
+
+        [[nodiscard]] inline auto operator[](usize index) noexcept -> Row {
+            return {this, index};
+        }
+
+        [[nodiscard]] inline auto operator[](usize index) const noexcept -> ConstRow {
+            return {this, index};
+        }
+    };
+}// namespace kstd::reflect
@@ -0,0 +1,108 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace kstd::reflect {
+#if defined(KSTD_REFLECT_ENABLE_STATS)
+    inline constexpr bool is_stats_enabled = true;
+#else
+    // Define KSTD_REFLECT_ENABLE_STATS to collect counters, otherwise every update compiles to nothing
+    inline constexpr bool is_stats_enabled = false;
+#endif
+
+    enum class StatCounter : u8 {
+        LOOKUP_HITS,
+        LOOKUP_MISSES,
+        TYPE_NAME_CALLS,      // Resolutions of type names when an element is registered
+        TYPE_NAME_NANOSECONDS,// Time spent in those resolutions
+        KEY_ALLOCATIONS,      // Copies of key parts made by the string pool
+        KEY_ALLOCATION_BYTES
+    };
+
+    inline constexpr usize stat_counter_count = static_cast<usize>(StatCounter::KEY_ALLOCATION_BYTES) + 1;
+
+    namespace detail {
+        inline constexpr usize stat_shard_count = 32;
+
+        // One cache line per shard, so threads updating different shards do not contend
+        struct alignas(64) StatShard final {
+            std::array<std::atomic<u64>, stat_counter_count> values {};
+        };
+
+        inline std::array<StatShard, stat_shard_count> stat_shards {};// NOLINT
+        inline std::atomic<usize> next_stat_shard {0};                // NOLINT
+
+        // Threads are assigned shards round-robin on their first update
+        [[nodiscard]] inline auto get_stat_shard() noexcept -> StatShard& {
+            static thread_local const auto s_index = next_stat_shard.fetch_add(1, std::memory_order_relaxed);
+            return stat_shards[s_index % stat_shard_count];
+        }
+
+        inline auto add_to_counter(StatCounter counter, u64 value = 1) noexcept -> void {
+            if constexpr(is_stats_enabled) {
+                get_stat_shard().values[static_cast<usize>(counter)].fetch_add(value, std::memory_order_relaxed);
+            }
+        }
+
+        // Sums the given counter over all shards, updates racing with this may or may not be included
+        [[nodiscard]] inline auto get_counter(StatCounter counter) noexcept -> u64 {
+            u64 result = 0;
+
+            for(const auto& shard : stat_shards) {
+                result += shard.values[static_cast<usize>(counter)].load(std::memory_order_relaxed);
+            }
+
+            return result;
+        }
+
+        // Adds the lifetime of the instance in nanoseconds to the given counter
+        class StatTimer final {
+            using Clock = std::chrono::steady_clock;
+
+            StatCounter _counter;
+            Clock::time_point _start {};
+
+            public:
+            KSTD_NO_MOVE_COPY(StatTimer)
+
+            explicit StatTimer(StatCounter counter) noexcept :
+                    _counter {counter} {
+                if constexpr(is_stats_enabled) {
+                    _start = Clock::now();
+                }
+            }
+
+            ~StatTimer() noexcept {
+                if constexpr(is_stats_enabled) {
+                    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _start);
+                    add_to_counter(_counter, static_cast<u64>(duration.count()));
+                }
+            }
+        };
+    }// namespace detail
+}// namespace kstd::reflect
@@ -0,0 +1,357 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/pack.hpp>
+#include <kstd/types.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "element_type.hpp"
+#include "function_traits.hpp"
+#include "perfect_hash.hpp"
+#include "preprocessor.hpp"
+#include "registry.hpp"
+#include "type_name.hpp"
+
+// Fields known at compile time
+#define KSTD_STATIC_FIELD(t, f) \
+    kstd::reflect::StaticFieldInfo<t, decltype(t::f)> {#f, offsetof(t, f), &t::f}
+// Declares the static field list of a type, has to be used in the namespace of the type
+#define KSTD_STATIC_REFLECT_STRUCT(t, ...)                                                             \
+    [[maybe_unused]] constexpr auto kstd_reflect_static_fields(kstd::reflect::StaticTag<t>) noexcept { \
+        return std::make_tuple(KSTD_REFLECT_FOR_EACH(KSTD_STATIC_FIELD, t, __VA_ARGS__));              \
+    }
+
+namespace kstd::reflect {
+    // Selects the static field list of a type through argument dependent lookup
+    template<typename T>
+    struct StaticTag final {};
+
+    namespace detail {
+        template<typename T, typename = void>
+        struct HasStaticFields : std::false_type {};
+
+        template<typename T>
+        struct HasStaticFields<T, std::void_t<decltype(kstd_reflect_static_fields(StaticTag<T> {}))>>
+                : std::true_type {};
+
+        template<typename T>
+        [[nodiscard]] constexpr auto get_static_fields() noexcept {
+            if constexpr(HasStaticFields<T>::value) {
+                return kstd_reflect_static_fields(StaticTag<T> {});
+            }
+            else {
+                return std::tuple<> {};
+            }
+        }
+
+        // Perfect hash over the names of a static field list, built during compilation
+        template<usize COUNT>
+        struct StaticFieldTable final {
+            static constexpr usize bucket_count = next_power_of_two(COUNT);
+            static constexpr usize slot_count = next_power_of_two(COUNT << 1U);
+
+            std::array<std::string_view, COUNT> names;
+            std::array<u64, COUNT> hashes;
+            std::array<u32, bucket_count> seeds;
+            std::array<u32, slot_count> slots;
+            bool is_perfect;
+
+            [[nodiscard]] constexpr auto find(std::string_view name) const noexcept -> usize {
+                if constexpr(COUNT == 0) {
+                    return 0;
+                }
+                else {
+                    const auto hash = hash_string(name);
+                    const auto seed = seeds[get_bucket(hash, bucket_count)];
+                    const auto slot = slots[get_slot(hash, seed, slot_count)];
+                    return slot != empty_slot && names[slot] == name ? slot : COUNT;
+                }
+            }
+        };
+
+        template<typename FIELDS, usize... INDICES>
+        [[nodiscard]] constexpr auto make_static_field_table(const FIELDS& fields, std::index_sequence<INDICES...>) noexcept
+                -> StaticFieldTable<sizeof...(INDICES)> {
+            using Table = StaticFieldTable<sizeof...(INDICES)>;
+            Table table {{std::get<INDICES>(fields).name...}, {hash_string(std::get<INDICES>(fields).name)...}, {}, {},
+                         false};
+
+            for(auto& slot : table.slots) {
+                slot = empty_slot;
+            }
+
+            table.is_perfect = build_perfect_hash(table.hashes, sizeof...(INDICES), table.seeds, Table::bucket_count,
+                                                  table.slots, Table::slot_count);
+            return table;
+        }
+
+        template<typename T>
+        inline constexpr auto static_field_table = make_static_field_table(
+                get_static_fields<T>(), std::make_index_sequence<std::tuple_size_v<decltype(get_static_fields<T>())>> {});
+    }// namespace detail
+
+    /**
+     * Compile-time counterpart of TypeInfo, which never touches the registry.
+     * Every query is constexpr, so generic code can branch on it with if constexpr.
+     */
+    template<typename T>
+    struct StaticTypeInfo final {
+        using Type = T;
+
+        [[nodiscard]] constexpr auto get_type_name() const noexcept -> std::string_view {
+            return type_name_v<Type>;
+        }
+
+        // Equal to the hash of the TypeInfo registered for this type, only constexpr outside of anonymous namespaces
+        [[nodiscard]] constexpr auto get_hash() const noexcept -> u64 {
+            if constexpr(detail::is_internal_type_v<Type>) {
+                return RegistryKey {ElementType::TYPE, {}, detail::get_internal_type_name<Type>(), {}}.hash();
+            }
+            else {
+                return RegistryKey {ElementType::TYPE, {}, type_name_v<Type>, {}}.hash();
+            }
+        }
+
+        [[nodiscard]] constexpr auto get_element_type() const noexcept -> ElementType {
+            return ElementType::TYPE;
+        }
+
+        [[nodiscard]] constexpr auto is_primitive() const noexcept -> bool {
+            return std::is_integral_v<Type> || std::is_floating_point_v<Type> || std::is_same_v<Type, bool>;
+        }
+
+        [[nodiscard]] constexpr auto get_size() const noexcept -> usize {
+            return sizeof(Type);
+        }
+
+        [[nodiscard]] constexpr auto get_alignment() const noexcept -> usize {
+            return alignof(Type);
+        }
+
+        [[nodiscard, maybe_unused]] constexpr auto is_default_constructible() const noexcept -> bool {
+            return std::is_default_constructible_v<Type>;
+        }
+
+        [[nodiscard, maybe_unused]] constexpr auto is_destructible() const noexcept -> bool {
+            return std::is_destructible_v<Type>;
+        }
+
+        template<typename... ARGS>
+        [[nodiscard, maybe_unused]] constexpr auto is_constructible() const noexcept -> bool {
+            return std::is_constructible_v<Type, ARGS...>;
+        }
+
+        template<typename S>
+        [[nodiscard, maybe_unused]] constexpr auto is_sub_type() const noexcept -> bool {
+            return std::is_base_of_v<S, Type>;
+        }
+
+        template<typename S>
+        [[nodiscard, maybe_unused]] constexpr auto is_super_type() const noexcept -> bool {
+            return std::is_base_of_v<Type, S>;
+        }
+
+        // All fields declared through KSTD_STATIC_REFLECT_STRUCT, as a tuple of StaticFieldInfo
+        [[nodiscard]] constexpr auto get_fields() const noexcept {
+            return detail::get_static_fields<Type>();
+        }
+
+        [[nodiscard]] constexpr auto get_field_count() const noexcept -> usize {
+            return std::tuple_size_v<decltype(detail::get_static_fields<Type>())>;
+        }
+
+        template<usize INDEX>
+        [[nodiscard]] constexpr auto get_field() const noexcept {
+            return std::get<INDEX>(detail::get_static_fields<Type>());
+        }
+
+        /**
+         * Resolves the index of a field by its name through a perfect hash generated
+         * during compilation. Returns get_field_count() if there is no such field.
+         */
+        [[nodiscard]] constexpr auto find_field(std::string_view name) const noexcept -> usize {
+            static_assert(detail::static_field_table<Type>.is_perfect, "Field names could not be hashed perfectly");
+            return detail::static_field_table<Type>.find(name);
+        }
+
+        // Invokes the given function with every StaticFieldInfo of this type, in declaration order
+        template<typename F>
+        constexpr auto for_each_field(F&& function) const noexcept -> void {
+            std::apply(
+                    [&function](const auto&... fields) {
+                        (function(fields), ...);
+                    },
+                    detail::get_static_fields<Type>());
+        }
+
+        [[nodiscard]] constexpr auto operator==(const StaticTypeInfo&) const noexcept -> bool {
+            return true;
+        }
+    };
+
+    template<typename T>
+    inline constexpr StaticTypeInfo<T> static_type_info {};
+
+    template<typename T>
+    inline constexpr auto static_field_list = detail::get_static_fields<T>();
+
+    /**
+     * Compile-time counterpart of FieldInfo, created by KSTD_STATIC_FIELD.
+     * Access goes through the member pointer, so it is usable in constant expressions.
+     */
+    template<typename ET, typename T>
+    struct StaticFieldInfo final {
+        using EnclosingType = ET;
+        using Type = T;
+
+        std::string_view name;
+        usize offset;
+        Type EnclosingType::*member;
+
+        [[nodiscard]] constexpr auto get_type() const noexcept -> const StaticTypeInfo<Type>& {
+            return static_type_info<Type>;
+        }
+
+        [[nodiscard]] constexpr auto get_enclosing_type() const noexcept -> const StaticTypeInfo<EnclosingType>& {
+            return static_type_info<EnclosingType>;
+        }
+
+        [[nodiscard]] constexpr auto get_element_type() const noexcept -> ElementType {
+            return ElementType::FIELD;
+        }
+
+        // Equal to the hash of the FieldInfo registered for this field, only constexpr outside of anonymous namespaces
+        [[nodiscard]] constexpr auto get_hash() const noexcept -> u64 {
+            if constexpr(detail::is_internal_type_v<EnclosingType>) {
+                return RegistryKey {ElementType::FIELD, detail::get_internal_type_name<EnclosingType>(), name,
+                                    type_name_v<Type>}
+                        .hash();
+            }
+            else {
+                return RegistryKey {ElementType::FIELD, type_name_v<EnclosingType>, name, type_name_v<Type>}.hash();
+            }
+        }
+
+        [[nodiscard]] constexpr auto get(const EnclosingType& instance) const noexcept -> const Type& {
+            return instance.*member;
+        }
+
+        [[nodiscard]] constexpr auto get(EnclosingType& instance) const noexcept -> Type& {
+            return instance.*member;
+        }
+
+        constexpr auto set(EnclosingType& instance, const Type& value) const noexcept -> void {
+            instance.*member = value;
+        }
+    };
+
+    /**
+     * Compile-time counterpart of FunctionInfo and MemberFunctionInfo for the given
+     * function pointer. Calls are direct, so they inline like calling the function itself.
+     */
+    template<auto FUNCTION>
+    struct StaticFunctionInfo final {
+        using FunctionType = decltype(FUNCTION);
+
+        private:
+        using Traits = detail::FunctionTraits<FunctionType>;
+
+        public:
+        using EnclosingType = typename Traits::EnclosingType;
+        using ReturnType = typename Traits::ReturnType;
+        using ParameterTypes = typename Traits::ParameterTypes;
+        using SignatureType = typename Traits::SignatureType;
+
+        [[nodiscard]] constexpr auto get_type_name() const noexcept -> std::string_view {
+            return type_name_v<SignatureType>;
+        }
+
+        [[nodiscard]] constexpr auto get_element_type() const noexcept -> ElementType {
+            return Traits::is_member ? ElementType::MEMBER_FUNCTION : ElementType::FUNCTION;
+        }
+
+        [[nodiscard]] constexpr auto get_function() const noexcept -> FunctionType {
+            return FUNCTION;
+        }
+
+        [[nodiscard]] constexpr auto is_member() const noexcept -> bool {
+            return Traits::is_member;
+        }
+
+        [[nodiscard]] constexpr auto is_const() const noexcept -> bool {
+            return Traits::is_const;
+        }
+
+        [[nodiscard]] constexpr auto is_volatile() const noexcept -> bool {
+            return Traits::is_volatile;
+        }
+
+        [[nodiscard]] constexpr auto is_noexcept() const noexcept -> bool {
+            return Traits::is_noexcept;
+        }
+
+        [[nodiscard]] constexpr auto get_flags() const noexcept -> FunctionFlags {
+            return Traits::flags;
+        }
+
+        [[nodiscard]] constexpr auto get_return_type() const noexcept -> const StaticTypeInfo<ReturnType>& {
+            return static_type_info<ReturnType>;
+        }
+
+        template<usize INDEX>
+        [[nodiscard]] constexpr auto get_param() const noexcept
+                -> const StaticTypeInfo<PackElementT<INDEX, ParameterTypes>>& {
+            return static_type_info<PackElementT<INDEX, ParameterTypes>>;
+        }
+
+        [[nodiscard]] constexpr auto get_param_count() const noexcept -> usize {
+            return Traits::param_count;
+        }
+
+        // Member functions take the instance as their first argument
+        template<typename... ARGS>
+        constexpr auto invoke(ARGS&&... args) const noexcept(Traits::is_noexcept) -> ReturnType {
+            if constexpr(Traits::is_member) {
+                return invoke_member(std::forward<ARGS>(args)...);
+            }
+            else {
+                return FUNCTION(std::forward<ARGS>(args)...);
+            }
+        }
+
+        private:
+        template<typename I, typename... ARGS>
+        static constexpr auto invoke_member(I&& instance, ARGS&&... args) noexcept(Traits::is_noexcept)
+                -> ReturnType {
+            return (std::forward<I>(instance).*FUNCTION)(std::forward<ARGS>(args)...);
+        }
+    };
+
+    template<auto FUNCTION>
+    inline constexpr StaticFunctionInfo<FUNCTION> static_function_info {};
+}// namespace kstd::reflect
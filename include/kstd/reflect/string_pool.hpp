@@ -0,0 +1,179 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <string_view>
+
+#include "arena.hpp"
+#include "hash.hpp"
+#include "concurrent_table.hpp"
+#include "stat_counters.hpp"
+
+namespace kstd::reflect {
+    /**
+     * Concurrent pool of interned strings. Every distinct string is stored
+     * exactly once, so two interned views are equal if and only if their
+     * data pointers are equal. Interned views stay valid for the lifetime
+     * of the pool.
+     */
+    class StringPool final {
+        struct Node final {
+            u64 hash;
+            std::string_view value;
+
+            Node(u64 hash, std::string_view value) noexcept :
+                    hash {hash},
+                    value {value} {
+            }
+
+            // Allocates the node and a copy of the given string in one block
+            [[nodiscard]] static inline auto create_owned(Arena& arena, u64 hash, std::string_view value) noexcept
+                    -> Node* {
+                auto* memory = static_cast<char*>(arena.allocate(sizeof(Node) + value.size() + 1, alignof(Node)));
+                auto* data = memory + sizeof(Node);// NOLINT
+                std::memcpy(data, value.data(), value.size());
+                data[value.size()] = '\0';// NOLINT
+                return new(memory) Node(hash, {data, value.size()});
+            }
+
+            [[nodiscard]] static inline auto create_static(Arena& arena, u64 hash, std::string_view value) noexcept
+                    -> Node* {
+                return arena.create<Node>(hash, value);
+            }
+
+            // The memory of the node belongs to the arena
+            static inline auto destroy(Node* node) noexcept -> void {
+                node->~Node();
+            }
+        };
+
+        Arena _arena;// Declared first, so it outlives all nodes
+        detail::ConcurrentTable<Node> _nodes;
+        std::atomic<usize> _byte_size {0};
+
+        template<bool OWNED>
+        [[nodiscard]] inline auto intern(std::string_view value) noexcept -> std::string_view {
+            return intern<OWNED>(value, hash_string(value));
+        }
+
+        template<bool OWNED>
+        [[nodiscard]] inline auto intern(std::string_view value, u64 hash) noexcept -> std::string_view {
+            const auto predicate = [value](const Node& node) noexcept {
+                return node.value == value;
+            };
+
+            if(const auto* node = _nodes.find(hash, predicate); node != nullptr) {
+                return node->value;
+            }
+
+            auto* node = OWNED ? Node::create_owned(_arena, hash, value) : Node::create_static(_arena, hash, value);
+            auto* winner = _nodes.insert(node, predicate);
+
+            if(winner != node) {
+                Node::destroy(node);// Another thread interned the same string first
+                return winner->value;
+            }
+
+            _byte_size.fetch_add(sizeof(Node) + (OWNED ? value.size() + 1 : 0), std::memory_order_relaxed);
+
+            if constexpr(OWNED) {
+                detail::add_to_counter(StatCounter::KEY_ALLOCATIONS);
+                detail::add_to_counter(StatCounter::KEY_ALLOCATION_BYTES, value.size() + 1);
+            }
+
+            return winner->value;
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(StringPool)
+
+        constexpr StringPool() noexcept = default;
+
+        ~StringPool() noexcept = default;
+
+        /**
+         * Interns a copy of the given string, unless an equal string
+         * was interned before.
+         */
+        [[nodiscard]] inline auto intern(std::string_view value) noexcept -> std::string_view {
+            return intern<true>(value);
+        }
+
+        /**
+         * Interns the given string without copying it, unless an equal string
+         * was interned before. The given string has to outlive the pool.
+         */
+        [[nodiscard]] inline auto intern_static(std::string_view value) noexcept -> std::string_view {
+            return intern<false>(value);
+        }
+
+        // Like intern_static, for callers which already know the hash_string() of the given string
+        [[nodiscard]] inline auto intern_static(std::string_view value, u64 hash) noexcept -> std::string_view {
+            return intern<false>(value, hash);
+        }
+
+        /**
+         * Interns the given substring of a string which has been interned
+         * before, so the substring shares the storage of the interned string.
+         */
+        [[nodiscard]] inline auto intern_substring(std::string_view value, usize offset,
+                                                   usize count = std::string_view::npos) noexcept -> std::string_view {
+            return intern<false>(intern<true>(value).substr(offset, count));
+        }
+
+        inline auto reserve(usize size) noexcept -> void {
+            _nodes.reserve(size);
+        }
+
+        // Invokes the given function with every interned string and its hash
+        template<typename F>
+        inline auto for_each(F&& function) const noexcept -> void {
+            _nodes.for_each([&function](const Node& node) {
+                function(node.value, node.hash);
+            });
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _nodes.get_size();
+        }
+
+        [[nodiscard]] inline auto get_byte_size() const noexcept -> usize {
+            return _byte_size.load(std::memory_order_relaxed) + _nodes.get_byte_size();
+        }
+    };
+
+    namespace detail {
+        inline StringPool string_pool;// NOLINT
+    }// namespace detail
+
+    /**
+     * Retrieves the string pool shared by all translation units of the process.
+     */
+    [[nodiscard]] inline auto get_string_pool() noexcept -> StringPool& {
+        return detail::string_pool;
+    }
+}// namespace kstd::reflect
\ No newline at end of file
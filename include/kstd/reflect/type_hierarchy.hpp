@@ -0,0 +1,253 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "perfect_hash.hpp"
+#include "reflection_fwd.hpp"
+#include "rtti.hpp"
+
+namespace kstd::reflect {
+    // Returned for types which do not derive from the requested base, or only ambiguously
+    inline constexpr usize invalid_base_offset = std::numeric_limits<usize>::max();
+
+    struct BaseEntry final {
+        const RTTI* type;
+        usize offset;     // Of the base subobject within the derived object
+        bool is_ambiguous;// Reached through more than one path, so there is no unique subobject
+    };
+
+    /**
+     * Immutable inheritance graph of a single type, which holds its registered
+     * direct bases and the transitive closure of all their bases. The closure
+     * is indexed by the registry hashes of its types through a perfect hash,
+     * so checking whether a type derives from another compares a single entry
+     * independent of the depth and width of the hierarchy.
+     */
+    class TypeHierarchy final {
+        static constexpr usize linear_search_limit = 4;
+
+        std::vector<BaseEntry> _bases;    // Direct bases in registration order
+        std::vector<BaseEntry> _ancestors;// Direct and indirect bases, offsets are relative to this type
+        PerfectHash _index;               // Falls back to a linear search if it could not be built
+        u64 _generation {0};
+        std::unique_ptr<const TypeHierarchy> _previous;// Kept alive for concurrent readers
+
+        inline auto add_ancestor(const RTTI* type, usize offset, bool is_ambiguous) noexcept -> void {
+            const auto entry = std::find_if(_ancestors.begin(), _ancestors.end(), [type](const auto& ancestor) {
+                return ancestor.type->is_same(*type);
+            });
+
+            if(entry != _ancestors.end()) {
+                entry->is_ambiguous = true;
+                return;
+            }
+
+            _ancestors.push_back({type, offset, is_ambiguous});
+        }
+
+        inline auto build() noexcept -> void {
+            for(const auto& base : _bases) {
+                add_ancestor(base.type, base.offset, false);
+                const auto* hierarchy = base.type->get_hierarchy();
+
+                if(hierarchy == nullptr) {
+                    continue;
+                }
+
+                for(const auto& ancestor : hierarchy->_ancestors) {
+                    add_ancestor(ancestor.type, base.offset + ancestor.offset, ancestor.is_ambiguous);
+                }
+            }
+
+            std::vector<u64> hashes;
+            hashes.reserve(_ancestors.size());
+
+            for(const auto& ancestor : _ancestors) {
+                hashes.push_back(ancestor.type->get_hash());
+            }
+
+            _index = PerfectHash {std::move(hashes)};
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(TypeHierarchy)
+
+        TypeHierarchy() noexcept = default;
+
+        /**
+         * Creates a hierarchy with the given direct bases, whose closure is taken from
+         * the current hierarchies of the bases. The previous hierarchy of the same type
+         * is only kept alive.
+         */
+        TypeHierarchy(const TypeHierarchy* previous, std::vector<BaseEntry> bases, u64 generation) noexcept :
+                _bases {std::move(bases)},
+                _generation {generation},
+                _previous {previous} {
+            build();
+        }
+
+        ~TypeHierarchy() noexcept = default;
+
+        [[nodiscard]] inline auto get_bases() const noexcept -> const std::vector<BaseEntry>& {
+            return _bases;
+        }
+
+        [[nodiscard]] inline auto get_ancestors() const noexcept -> const std::vector<BaseEntry>& {
+            return _ancestors;
+        }
+
+        // The registration state this hierarchy was built from, see detail::type_hierarchy_generation
+        [[nodiscard]] inline auto get_generation() const noexcept -> u64 {
+            return _generation;
+        }
+
+        // Whether lookups go through the perfect hash instead of a linear search
+        [[nodiscard, maybe_unused]] inline auto is_perfect() const noexcept -> bool {
+            return _index.is_perfect();
+        }
+
+        // Returns the direct or indirect base of the given type, null if there is none
+        [[nodiscard]] inline auto find(const RTTI& type) const noexcept -> const BaseEntry* {
+            // Shallow hierarchies are scanned, which is cheaper than hashing
+            if(!_index.is_perfect() || _ancestors.size() <= linear_search_limit) {
+                const auto entry = std::find_if(_ancestors.cbegin(), _ancestors.cend(), [&type](const auto& ancestor) {
+                    return ancestor.type->is_same(type);
+                });
+                return entry != _ancestors.cend() ? &*entry : nullptr;
+            }
+
+            const auto slot = _index.find(type.get_hash());
+
+            if(slot == _index.get_size()) {
+                return nullptr;
+            }
+
+            const auto& ancestor = _ancestors[slot];
+            return ancestor.type->is_same(type) ? &ancestor : nullptr;
+        }
+
+        // The offset of the unique base subobject of the given type, or invalid_base_offset
+        [[nodiscard]] inline auto get_offset(const RTTI& type) const noexcept -> usize {
+            const auto* entry = find(type);
+            return entry != nullptr && !entry->is_ambiguous ? entry->offset : invalid_base_offset;
+        }
+    };
+
+    namespace detail {
+        inline const TypeHierarchy empty_type_hierarchy {};// NOLINT
+
+        // Serializes changes to the hierarchy of any type, rebuilding a hierarchy also rebuilds its bases
+        inline std::recursive_mutex type_hierarchy_mutex;// NOLINT
+
+        /**
+         * Advanced whenever bases are registered for any type. Hierarchies built
+         * before that may lack indirect bases, so they rebuild their closure on
+         * the next lookup. This lets bases be registered in any order.
+         */
+        inline std::atomic<u64> type_hierarchy_generation {0};// NOLINT
+
+        // Publishes the current hierarchy of a type, each change replaces it with a rebuilt copy
+        class HierarchySlot final {
+            mutable std::atomic<const TypeHierarchy*> _hierarchy {nullptr};
+
+            [[nodiscard]] inline auto rebuild() const noexcept -> const TypeHierarchy& {
+                const std::lock_guard<std::recursive_mutex> lock {type_hierarchy_mutex};
+                const auto* current = _hierarchy.load(std::memory_order_relaxed);
+                const auto generation = type_hierarchy_generation.load(std::memory_order_relaxed);
+
+                if(current->get_generation() != generation) {
+                    current = new TypeHierarchy(current, current->get_bases(), generation);// NOLINT
+                    _hierarchy.store(current, std::memory_order_release);
+                }
+
+                return *current;
+            }
+
+            public:
+            KSTD_NO_MOVE_COPY(HierarchySlot)
+
+            HierarchySlot() noexcept = default;
+
+            ~HierarchySlot() noexcept {
+                delete _hierarchy.load(std::memory_order_acquire);
+            }
+
+            [[nodiscard]] inline auto get() const noexcept -> const TypeHierarchy& {
+                const auto* hierarchy = _hierarchy.load(std::memory_order_acquire);
+
+                if(hierarchy == nullptr) {
+                    return empty_type_hierarchy;
+                }
+
+                if(hierarchy->get_generation() != type_hierarchy_generation.load(std::memory_order_acquire)) {
+                    return rebuild();
+                }
+
+                return *hierarchy;
+            }
+
+            // Adding the same base more than once has no effect
+            inline auto add_all(const BaseEntry* bases, usize count) noexcept -> void {
+                const std::lock_guard<std::recursive_mutex> lock {type_hierarchy_mutex};
+                const auto* current = _hierarchy.load(std::memory_order_relaxed);
+                std::vector<BaseEntry> merged;
+
+                if(current != nullptr) {
+                    merged = current->get_bases();
+                }
+
+                const auto previous_size = merged.size();
+
+                for(usize index = 0; index < count; ++index) {
+                    const auto& base = bases[index];// NOLINT
+
+                    if(std::none_of(merged.cbegin(), merged.cend(), [&base](const auto& entry) {
+                           return entry.type->is_same(*base.type);
+                       })) {
+                        merged.push_back(base);
+                    }
+                }
+
+                if(merged.size() == previous_size) {
+                    return;
+                }
+
+                const auto generation = type_hierarchy_generation.load(std::memory_order_relaxed) + 1;
+                type_hierarchy_generation.store(generation, std::memory_order_release);
+                _hierarchy.store(new TypeHierarchy(current, std::move(merged), generation),// NOLINT
+                                 std::memory_order_release);
+            }
+        };
+
+        template<typename T>
+        inline HierarchySlot hierarchy_slot;// NOLINT
+    }// namespace detail
+}// namespace kstd::reflect
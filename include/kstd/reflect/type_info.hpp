@@ -20,10 +20,15 @@
 #pragma once
 
 #include <kstd/defaults.hpp>
-#include <string>
+#include <string_view>
+#include <vector>
 
+#include "member_index.hpp"
+#include "object_pool.hpp"
 #include "reflection_fwd.hpp"
 #include "rtti.hpp"
+#include "type_hierarchy.hpp"
+#include "type_layout.hpp"
 
 namespace kstd::reflect {
     template<typename T>
@@ -34,24 +39,26 @@ namespace kstd::reflect {
         using Self = TypeInfo<Type>;
 
         protected:
-        std::string _mangled_type_name;// NOLINT
-        std::string _type_name;        // NOLINT
+        std::string_view _mangled_type_name;// NOLINT
+        std::string_view _type_name;        // NOLINT
 
         public:
         KSTD_DEFAULT_MOVE_COPY(TypeInfo, Self)
 
-        TypeInfo(std::string mangled_type_name, std::string type_name) noexcept :
-                _mangled_type_name {std::move(mangled_type_name)},
-                _type_name {std::move(type_name)} {
+        // Both names are expected to point to storage which outlives this instance
+        TypeInfo(std::string_view mangled_type_name, std::string_view type_name) noexcept :
+                RTTI(make_type_traits<Type>()),
+                _mangled_type_name {mangled_type_name},
+                _type_name {type_name} {
         }
 
         ~TypeInfo() noexcept override = default;
 
-        [[nodiscard]] auto get_mangled_type_name() const noexcept -> const std::string& override {
+        [[nodiscard]] auto get_mangled_type_name() const noexcept -> std::string_view override {
             return _mangled_type_name;
         }
 
-        [[nodiscard]] auto get_type_name() const noexcept -> const std::string& override {
+        [[nodiscard]] auto get_type_name() const noexcept -> std::string_view override {
             return _type_name;
         }
 
@@ -59,10 +66,38 @@ namespace kstd::reflect {
             return ElementType::TYPE;
         }
 
-        [[nodiscard]] auto is_same(const RTTI& other) const noexcept -> bool override {
+        [[nodiscard]] auto is_equivalent(const RTTI& other) const noexcept -> bool override {
             return other.get_element_type() == ElementType::TYPE && other.get_mangled_type_name() == _mangled_type_name;
         }
 
+        // Variables and fields derive from this, but do not describe an instantiable type themselves
+        [[nodiscard]] auto get_lifecycle() const noexcept -> const TypeLifecycle* override {
+            if constexpr(detail::has_lifecycle_v<Type>) {
+                return get_element_type() == ElementType::TYPE ? &detail::type_lifecycle<Type> : nullptr;
+            }
+            else {
+                return nullptr;
+            }
+        }
+
+        [[nodiscard]] auto get_hierarchy() const noexcept -> const TypeHierarchy* override {
+            if constexpr(std::is_class_v<Type>) {
+                return get_element_type() == ElementType::TYPE ? &detail::hierarchy_slot<Type>.get() : nullptr;
+            }
+            else {
+                return nullptr;
+            }
+        }
+
+        [[nodiscard]] auto is_derived_from(const RTTI& other) const noexcept -> bool override {
+            if(is_same(other)) {
+                return true;
+            }
+
+            const auto* hierarchy = get_hierarchy();
+            return hierarchy != nullptr && hierarchy->find(other) != nullptr;
+        }
+
         [[nodiscard]] inline constexpr auto is_primitive() const noexcept -> bool {
             return std::is_integral_v<Type> || std::is_floating_point_v<Type> || std::is_same_v<Type, bool>;
         }
@@ -109,5 +144,80 @@ namespace kstd::reflect {
                 -> bool {
             return std::is_base_of_v<Type, S>;
         }
+
+        // Contains every field of this type which has been looked up so far
+        [[nodiscard]] inline auto get_layout() const noexcept -> const TypeLayout& {
+            return detail::layout_slot<Type>.get();
+        }
+
+        // All registered fields of this type, sorted by offset
+        [[nodiscard]] inline auto get_fields() const noexcept -> const std::vector<FieldLayout>& {
+            return get_layout().get_fields();
+        }
+
+        // Resolves the FieldInfo registered for the given field of this type
+        [[nodiscard]] inline auto get_field(const FieldLayout& field) const noexcept -> const RTTI* {
+            return get_registry().find(
+                    {ElementType::FIELD, get_type_key_name<Type>(), field.name, field.type_name});
+        }
+
+        // Default constructs an instance in the given uninitialized storage
+        inline auto construct_at(void* address) const noexcept -> void {
+            static_assert(std::is_nothrow_default_constructible_v<Type>, "Constructor must not throw");
+            detail::construct_object<std::remove_cv_t<Type>>(address);
+        }
+
+        inline auto destruct_at(void* address) const noexcept -> void {
+            detail::destruct_object<std::remove_cv_t<Type>>(address);
+        }
+
+        inline auto copy_construct_at(void* address, const void* source) const noexcept -> void {
+            static_assert(std::is_nothrow_copy_constructible_v<Type>, "Copy constructor must not throw");
+            detail::copy_construct_object<std::remove_cv_t<Type>>(address, source);
+        }
+
+        inline auto move_construct_at(void* address, void* source) const noexcept -> void {
+            static_assert(std::is_nothrow_move_constructible_v<Type>, "Move constructor must not throw");
+            detail::move_construct_object<std::remove_cv_t<Type>>(address, source);
+        }
+
+        // Contains every field and member function of this type which has been looked up so far
+        [[nodiscard]] inline auto get_members() const noexcept -> const MemberIndex& {
+            return detail::member_slot<Type>.get();
+        }
+
+        // Resolves a registered field by its unqualified name without allocating, null if there is none
+        [[nodiscard]] inline auto find_field(std::string_view name) const noexcept -> const RTTI* {
+            return get_members().find(name, ElementType::FIELD);
+        }
+
+        // Resolves the first registered overload of a member function by its unqualified name
+        [[nodiscard]] inline auto find_function(std::string_view name) const noexcept -> const RTTI* {
+            return get_members().find(name, ElementType::MEMBER_FUNCTION);
+        }
+
+        template<typename U = Type>
+        [[nodiscard]] inline auto copy(U& destination, const U& source) const noexcept -> Result<usize> {
+            static_assert(std::is_same_v<U, Type>, "Value has to be of the reflected type");
+            return get_layout().copy(&destination, &source);
+        }
+
+        template<typename U = Type>
+        [[nodiscard]] inline auto equals(const U& lhs, const U& rhs) const noexcept -> Result<bool> {
+            static_assert(std::is_same_v<U, Type>, "Values have to be of the reflected type");
+            return get_layout().equals(&lhs, &rhs);
+        }
+
+        template<typename U = Type>
+        [[nodiscard]] inline auto hash(const U& value) const noexcept -> Result<u64> {
+            static_assert(std::is_same_v<U, Type>, "Value has to be of the reflected type");
+            return get_layout().hash(&value);
+        }
+
+        template<typename U = Type>
+        [[nodiscard]] inline auto swap(U& lhs, U& rhs) const noexcept -> Result<usize> {
+            static_assert(std::is_same_v<U, Type>, "Values have to be of the reflected type");
+            return get_layout().swap(&lhs, &rhs);
+        }
     };
 }// namespace kstd::reflect
\ No newline at end of file
@@ -0,0 +1,622 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "element_type.hpp"
+#include "hash.hpp"
+#include "perfect_hash.hpp"
+#include "registry.hpp"
+#include "type_name.hpp"
+
+namespace kstd::reflect {
+    class TypeLayout;
+
+    // Classifies the value of a field for codecs which handle it without knowing its type
+    enum class FieldKind : u8 {
+        OTHER,
+        BOOL,
+        SIGNED,
+        UNSIGNED,
+        FLOAT,
+        STRING,// std::string
+        STRUCT // Class type, described by its own layout
+    };
+
+    using FieldCopyFunction = void (*)(void* destination, const void* source) noexcept;
+    using FieldEqualsFunction = bool (*)(const void* lhs, const void* rhs) noexcept;
+    using FieldHashFunction = u64 (*)(const void* value) noexcept;
+    using FieldSwapFunction = void (*)(void* lhs, void* rhs) noexcept;
+    using FieldGetBytesFunction = const void* (*)(const void* value, usize& size) noexcept;
+    using FieldSetBytesFunction = void (*)(void* value, const void* data, usize size) noexcept;
+    using FieldGetLayoutFunction = const TypeLayout& (*) () noexcept;
+
+    /**
+     * Describes where a field lives within its enclosing type and how to handle it
+     * without knowing its type. Functions are null if the field type does not
+     * support the respective operation.
+     */
+    struct FieldLayout final {
+        usize offset;
+        usize size;
+        u64 type_id;// Hash of the registry key of the field type
+        std::string_view name;     // Interned
+        std::string_view type_name;// Together with the name, forms the registry key of the field
+        bool is_trivially_copyable;
+        bool has_unique_representation;// Equal values are bitwise equal, so memcmp and hash_bytes apply
+        bool is_serializable;          // Bitwise image or byte container which holds no addresses
+        bool is_const;                 // Must never be written after construction
+        FieldKind kind;
+        FieldCopyFunction copy;
+        FieldEqualsFunction equals;
+        FieldHashFunction hash;
+        FieldSwapFunction swap;
+        FieldGetBytesFunction get_bytes;// Set for contiguous containers of trivially copyable elements
+        FieldSetBytesFunction set_bytes;
+        FieldGetLayoutFunction get_layout;// Set for fields of kind STRUCT
+    };
+
+    // A range of bytes which is handled as a whole
+    struct LayoutSpan final {
+        usize offset;
+        usize size;
+    };
+
+    template<typename F>
+    struct LayoutOp final {
+        usize offset;
+        F function;
+    };
+
+    namespace detail {
+        template<typename T, typename = void>
+        struct HasEqualityOperator : std::false_type {};
+
+        template<typename T>
+        struct HasEqualityOperator<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+                : std::true_type {};
+
+        // Arrays would compare their addresses, which also triggers -Warray-compare, so they never get here
+        template<typename T>
+        struct IsEqualityComparable : std::conjunction<std::negation<std::is_array<T>>, HasEqualityOperator<T>> {};
+
+        template<typename T>
+        constexpr bool is_hashable_v = std::conjunction_v<std::is_default_constructible<std::hash<std::remove_cv_t<T>>>,
+                                                          std::is_invocable<std::hash<std::remove_cv_t<T>>, const T&>>;
+
+        // Volatile fields are never accessed through memcpy/memcmp
+        template<typename T>
+        constexpr bool is_bulk_copyable_v = std::is_trivially_copyable_v<T> && !std::is_volatile_v<T>;
+
+        // The serializer stores an offset and a size in place of every byte container, see SerialBlob
+        constexpr usize byte_container_slot_size = 2 * sizeof(u64);
+
+        // Matches std::basic_string and std::vector of trivially copyable elements
+        template<typename T, typename = void>
+        struct IsByteContainer : std::false_type {};
+
+        template<typename T>
+        struct IsByteContainer<T, std::void_t<typename T::value_type, decltype(std::declval<const T&>().data()),
+                                              decltype(std::declval<const T&>().size()),
+                                              decltype(std::declval<T&>().assign(
+                                                      std::declval<const typename T::value_type*>(),
+                                                      std::declval<const typename T::value_type*>()))>>
+                : std::bool_constant<std::is_trivially_copyable_v<typename T::value_type> && !std::is_volatile_v<T> &&
+                                     !std::is_const_v<T>> {};
+
+        // Addresses are meaningless to any other process, so they are never serialized
+        template<typename T>
+        constexpr bool is_address_v = std::is_pointer_v<std::remove_all_extents_t<T>> ||
+                                      std::is_member_pointer_v<std::remove_all_extents_t<T>>;
+
+        template<typename T>
+        [[nodiscard]] constexpr auto is_serializable_field() noexcept -> bool {
+            if constexpr(is_address_v<T>) {
+                return false;
+            }
+            else if constexpr(IsByteContainer<T>::value) {
+                return !is_address_v<typename T::value_type>;
+            }
+            else {
+                return is_bulk_copyable_v<T>;
+            }
+        }
+
+        template<typename T>
+        inline auto copy_field(void* destination, const void* source) noexcept -> void {
+            *static_cast<T*>(destination) = *static_cast<const T*>(source);
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto equals_field(const void* lhs, const void* rhs) noexcept -> bool {
+            return *static_cast<const T*>(lhs) == *static_cast<const T*>(rhs);
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto hash_field(const void* value) noexcept -> u64 {
+            return static_cast<u64>(std::hash<std::remove_cv_t<T>> {}(*static_cast<const T*>(value)));
+        }
+
+        template<typename T>
+        inline auto swap_field(void* lhs, void* rhs) noexcept -> void {
+            using std::swap;
+            swap(*static_cast<T*>(lhs), *static_cast<T*>(rhs));
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto get_field_bytes(const void* value, usize& size) noexcept -> const void* {
+            const auto& container = *static_cast<const T*>(value);
+            size = container.size() * sizeof(typename T::value_type);
+            return container.data();
+        }
+
+        template<typename T>
+        inline auto set_field_bytes(void* value, const void* data, usize size) noexcept -> void {
+            using Element = typename T::value_type;
+            const auto* first = static_cast<const Element*>(data);
+            static_cast<T*>(value)->assign(first, first + size / sizeof(Element));// NOLINT
+        }
+
+        inline auto swap_bytes(u8* lhs, u8* rhs, usize size) noexcept -> void {
+            constexpr usize chunk_size = 64;
+            u8 buffer[chunk_size];// NOLINT
+
+            while(size > 0) {
+                const auto count = std::min(size, chunk_size);
+                std::memcpy(buffer, lhs, count);// NOLINT
+                std::memcpy(lhs, rhs, count);
+                std::memcpy(rhs, buffer, count);// NOLINT
+                lhs += count;                   // NOLINT
+                rhs += count;                   // NOLINT
+                size -= count;
+            }
+        }
+
+        // Appends the given field to the last span if it directly follows it
+        inline auto extend_spans(std::vector<LayoutSpan>& spans, const FieldLayout& field) noexcept -> void {
+            if(!spans.empty()) {
+                auto& last = spans.back();
+
+                if(field.offset <= last.offset + last.size) {
+                    last.size = std::max(last.size, field.offset + field.size - last.offset);
+                    return;
+                }
+            }
+
+            spans.push_back({field.offset, field.size});
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr auto get_field_kind() noexcept -> FieldKind {
+            if constexpr(std::is_volatile_v<T>) {
+                return FieldKind::OTHER;
+            }
+            else if constexpr(std::is_same_v<std::remove_cv_t<T>, bool>) {
+                return FieldKind::BOOL;
+            }
+            else if constexpr(std::is_integral_v<T>) {
+                return std::is_signed_v<T> ? FieldKind::SIGNED : FieldKind::UNSIGNED;
+            }
+            else if constexpr(std::is_floating_point_v<T>) {
+                return sizeof(T) == sizeof(f32) || sizeof(T) == sizeof(f64) ? FieldKind::FLOAT : FieldKind::OTHER;
+            }
+            else if constexpr(std::is_same_v<std::remove_const_t<T>, std::string>) {
+                return FieldKind::STRING;
+            }
+            else if constexpr(std::is_class_v<T>) {
+                return FieldKind::STRUCT;
+            }
+            else {
+                return FieldKind::OTHER;
+            }
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto get_field_type_layout() noexcept -> const TypeLayout&;
+
+        // Serializes changes to the layout of any type, which only happen during registration
+        inline std::mutex layout_mutex;// NOLINT
+    }// namespace detail
+
+    template<typename T>
+    [[nodiscard]] inline auto make_field_layout(usize offset, std::string_view name) noexcept -> FieldLayout {
+        const RegistryKey key {ElementType::TYPE, {}, get_type_key_name<T>(), {}};
+        FieldLayout layout {offset,
+                            sizeof(T),
+                            key.hash(),
+                            name,
+                            type_name_v<T>,
+                            detail::is_bulk_copyable_v<T>,
+                            detail::is_bulk_copyable_v<T> && std::has_unique_object_representations_v<T>,
+                            detail::is_serializable_field<T>(),
+                            std::is_const_v<T>,
+                            detail::get_field_kind<T>(),
+                            nullptr,
+                            nullptr,
+                            nullptr,
+                            nullptr,
+                            nullptr,
+                            nullptr,
+                            nullptr};
+
+        if constexpr(std::is_copy_assignable_v<T>) {
+            layout.copy = &detail::copy_field<T>;
+        }
+
+        if constexpr(detail::IsEqualityComparable<T>::value) {
+            layout.equals = &detail::equals_field<T>;
+        }
+
+        if constexpr(detail::is_hashable_v<T>) {
+            layout.hash = &detail::hash_field<T>;
+        }
+
+        if constexpr(std::is_swappable_v<T>) {
+            layout.swap = &detail::swap_field<T>;
+        }
+
+        if constexpr(detail::IsByteContainer<T>::value) {
+            static_assert(sizeof(T) >= detail::byte_container_slot_size,
+                          "Byte container is too small to hold a serialized blob reference");
+            layout.get_bytes = &detail::get_field_bytes<T>;
+            layout.set_bytes = &detail::set_field_bytes<T>;
+        }
+
+        if constexpr(detail::get_field_kind<T>() == FieldKind::STRUCT) {
+            layout.get_layout = &detail::get_field_type_layout<std::remove_cv_t<T>>;
+        }
+
+        return layout;
+    }
+
+    /**
+     * Immutable table of the registered fields of a type, sorted by offset.
+     * Adjacent fields which can be handled bitwise are merged into spans, so bulk
+     * operations only fall back to per-field functions for the remaining fields.
+     * Operations fail as a whole if any field lacks support for them.
+     */
+    class TypeLayout final {
+        std::vector<FieldLayout> _fields;
+        std::vector<LayoutSpan> _copy_spans;
+        std::vector<LayoutSpan> _compare_spans;
+        std::vector<LayoutOp<FieldCopyFunction>> _copy_ops;
+        std::vector<LayoutOp<FieldEqualsFunction>> _equals_ops;
+        std::vector<LayoutOp<FieldHashFunction>> _hash_ops;
+        std::vector<LayoutOp<FieldSwapFunction>> _swap_ops;
+        bool _is_copyable {true};
+        bool _is_comparable {true};
+        bool _is_hashable {true};
+        bool _is_swappable {true};
+        bool _is_serializable {true};
+        u64 _hash {0};
+        PerfectHash _names;// Maps the name of every field to its index
+        std::unique_ptr<const TypeLayout> _previous;// Kept alive for concurrent readers
+
+        inline auto build() noexcept -> void {
+            std::vector<u64> name_hashes;
+            name_hashes.reserve(_fields.size());
+
+            for(const auto& field : _fields) {
+                name_hashes.push_back(hash_string(field.name));
+                // Type names instead of type IDs, which differ between processes for anonymous types
+                _hash = hash_combine(_hash, hash_combine(hash_combine(field.offset, field.size),
+                                                         hash_string(field.type_name)));
+                _is_serializable &= field.is_serializable;
+
+                if(field.is_trivially_copyable) {
+                    detail::extend_spans(_copy_spans, field);
+                }
+                else {
+                    _is_copyable &= field.copy != nullptr;
+                    _is_swappable &= field.swap != nullptr;
+
+                    if(field.copy != nullptr) {
+                        _copy_ops.push_back({field.offset, field.copy});
+                    }
+
+                    if(field.swap != nullptr) {
+                        _swap_ops.push_back({field.offset, field.swap});
+                    }
+                }
+
+                if(field.has_unique_representation) {
+                    detail::extend_spans(_compare_spans, field);
+                }
+                else {
+                    _is_comparable &= field.equals != nullptr;
+                    _is_hashable &= field.hash != nullptr;
+
+                    if(field.equals != nullptr) {
+                        _equals_ops.push_back({field.offset, field.equals});
+                    }
+
+                    if(field.hash != nullptr) {
+                        _hash_ops.push_back({field.offset, field.hash});
+                    }
+                }
+            }
+
+            _names = PerfectHash {std::move(name_hashes)};
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(TypeLayout)
+
+        TypeLayout() noexcept = default;
+
+        // Creates a copy of the given layout which additionally contains the given fields
+        TypeLayout(const TypeLayout* previous, const std::vector<FieldLayout>& fields) noexcept :
+                _previous {previous} {
+            if(previous != nullptr) {
+                _fields.reserve(previous->_fields.size() + fields.size());
+                _fields.assign(previous->_fields.cbegin(), previous->_fields.cend());
+            }
+
+            _fields.insert(_fields.cend(), fields.cbegin(), fields.cend());
+            std::stable_sort(_fields.begin(), _fields.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.offset < rhs.offset;
+            });
+            build();
+        }
+
+        ~TypeLayout() noexcept = default;
+
+        [[nodiscard]] inline auto contains(usize offset, u64 type_id) const noexcept -> bool {
+            return std::any_of(_fields.cbegin(), _fields.cend(), [&](const auto& field) {
+                return field.offset == offset && field.type_id == type_id;
+            });
+        }
+
+        [[nodiscard]] inline auto get_fields() const noexcept -> const std::vector<FieldLayout>& {
+            return _fields;
+        }
+
+        // Resolves a field by its name, null if there is none
+        [[nodiscard]] inline auto find_field(std::string_view name) const noexcept -> const FieldLayout* {
+            if(!_names.is_perfect()) {
+                const auto field = std::find_if(_fields.cbegin(), _fields.cend(), [name](const auto& field) {
+                    return field.name == name;
+                });
+                return field != _fields.cend() ? &*field : nullptr;
+            }
+
+            const auto index = _names.find(hash_string(name));
+            return index < _fields.size() && _fields[index].name == name ? &_fields[index] : nullptr;
+        }
+
+        [[nodiscard, maybe_unused]] inline auto get_copy_spans() const noexcept -> const std::vector<LayoutSpan>& {
+            return _copy_spans;
+        }
+
+        [[nodiscard, maybe_unused]] inline auto get_compare_spans() const noexcept -> const std::vector<LayoutSpan>& {
+            return _compare_spans;
+        }
+
+        [[nodiscard, maybe_unused]] inline auto is_copyable() const noexcept -> bool {
+            return _is_copyable;
+        }
+
+        [[nodiscard, maybe_unused]] inline auto is_comparable() const noexcept -> bool {
+            return _is_comparable;
+        }
+
+        [[nodiscard, maybe_unused]] inline auto is_hashable() const noexcept -> bool {
+            return _is_hashable;
+        }
+
+        [[nodiscard, maybe_unused]] inline auto is_swappable() const noexcept -> bool {
+            return _is_swappable;
+        }
+
+        // Every field is either trivially copyable or a contiguous container of such elements
+        [[nodiscard, maybe_unused]] inline auto is_serializable() const noexcept -> bool {
+            return _is_serializable;
+        }
+
+        // Changes whenever the offset, size or type of any field does
+        [[nodiscard]] inline auto get_hash() const noexcept -> u64 {
+            return _hash;
+        }
+
+        // Returns the number of copied fields
+        [[nodiscard]] inline auto copy(void* destination, const void* source) const noexcept -> Result<usize> {
+            using namespace std::string_literals;
+
+            if(!_is_copyable) {
+                return Error {"Type has fields which are not copyable"s};
+            }
+
+            auto* destination_bytes = static_cast<u8*>(destination);
+            const auto* source_bytes = static_cast<const u8*>(source);
+
+            for(const auto& span : _copy_spans) {
+                std::memcpy(destination_bytes + span.offset, source_bytes + span.offset, span.size);// NOLINT
+            }
+
+            for(const auto& op : _copy_ops) {
+                op.function(destination_bytes + op.offset, source_bytes + op.offset);// NOLINT
+            }
+
+            return _fields.size();
+        }
+
+        [[nodiscard]] inline auto equals(const void* lhs, const void* rhs) const noexcept -> Result<bool> {
+            using namespace std::string_literals;
+
+            if(!_is_comparable) {
+                return Error {"Type has fields which are not equality comparable"s};
+            }
+
+            const auto* lhs_bytes = static_cast<const u8*>(lhs);
+            const auto* rhs_bytes = static_cast<const u8*>(rhs);
+
+            for(const auto& span : _compare_spans) {
+                if(std::memcmp(lhs_bytes + span.offset, rhs_bytes + span.offset, span.size) != 0) {// NOLINT
+                    return false;
+                }
+            }
+
+            for(const auto& op : _equals_ops) {
+                if(!op.function(lhs_bytes + op.offset, rhs_bytes + op.offset)) {// NOLINT
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] inline auto hash(const void* value) const noexcept -> Result<u64> {
+            using namespace std::string_literals;
+
+            if(!_is_hashable) {
+                return Error {"Type has fields which are not hashable"s};
+            }
+
+            const auto* bytes = static_cast<const u8*>(value);
+            u64 result = 0;
+
+            for(const auto& span : _compare_spans) {
+                result = hash_combine(result, hash_bytes(bytes + span.offset, span.size));// NOLINT
+            }
+
+            for(const auto& op : _hash_ops) {
+                result = hash_combine(result, op.function(bytes + op.offset));// NOLINT
+            }
+
+            return result;
+        }
+
+        // Returns the number of swapped fields
+        [[nodiscard]] inline auto swap(void* lhs, void* rhs) const noexcept -> Result<usize> {
+            using namespace std::string_literals;
+
+            if(!_is_swappable) {
+                return Error {"Type has fields which are not swappable"s};
+            }
+
+            auto* lhs_bytes = static_cast<u8*>(lhs);
+            auto* rhs_bytes = static_cast<u8*>(rhs);
+
+            for(const auto& span : _copy_spans) {
+                detail::swap_bytes(lhs_bytes + span.offset, rhs_bytes + span.offset, span.size);// NOLINT
+            }
+
+            for(const auto& op : _swap_ops) {
+                op.function(lhs_bytes + op.offset, rhs_bytes + op.offset);// NOLINT
+            }
+
+            return _fields.size();
+        }
+    };
+
+    namespace detail {
+        inline const TypeLayout empty_layout {};// NOLINT
+
+        /**
+         * Publishes the current layout of a type, each new field replaces it with an extended copy.
+         * The declared layout holds the complete field set given to KSTD_REFLECT_STRUCT and
+         * never changes afterwards, so it can describe persistent formats.
+         */
+        class LayoutSlot final {
+            std::atomic<const TypeLayout*> _layout {nullptr};
+            std::atomic<const TypeLayout*> _declared {nullptr};
+
+            public:
+            KSTD_NO_MOVE_COPY(LayoutSlot)
+
+            LayoutSlot() noexcept = default;
+
+            ~LayoutSlot() noexcept {
+                delete _layout.load(std::memory_order_acquire);
+                delete _declared.load(std::memory_order_acquire);
+            }
+
+            [[nodiscard]] inline auto get() const noexcept -> const TypeLayout& {
+                const auto* layout = _layout.load(std::memory_order_acquire);
+                return layout != nullptr ? *layout : empty_layout;
+            }
+
+            // Null until the type has been declared
+            [[nodiscard]] inline auto get_declared() const noexcept -> const TypeLayout* {
+                return _declared.load(std::memory_order_acquire);
+            }
+
+            // Adding the same field more than once has no effect
+            inline auto add(const FieldLayout& field) noexcept -> void {
+                add_all(&field, 1);
+            }
+
+            // Publishes a single new layout for all given fields
+            inline auto add_all(const FieldLayout* fields, usize count) noexcept -> void {
+                const std::lock_guard<std::mutex> lock {layout_mutex};
+                const auto* current = _layout.load(std::memory_order_relaxed);
+                std::vector<FieldLayout> added;
+                added.reserve(count);
+
+                for(usize index = 0; index < count; ++index) {
+                    const auto& field = fields[index];// NOLINT
+
+                    if(current == nullptr || !current->contains(field.offset, field.type_id)) {
+                        added.push_back(field);
+                    }
+                }
+
+                if(!added.empty()) {
+                    _layout.store(new TypeLayout(current, added), std::memory_order_release);// NOLINT
+                }
+            }
+
+            // Adds the given fields and fixes them as the declared layout, only the first declaration counts
+            inline auto declare(const FieldLayout* fields, usize count) noexcept -> void {
+                add_all(fields, count);
+                const std::lock_guard<std::mutex> lock {layout_mutex};
+
+                if(_declared.load(std::memory_order_relaxed) == nullptr) {
+                    const std::vector<FieldLayout> declared(fields, fields + count);// NOLINT
+                    _declared.store(new TypeLayout(nullptr, declared), std::memory_order_release);// NOLINT
+                }
+            }
+        };
+
+        template<typename T>
+        inline LayoutSlot layout_slot;// NOLINT
+
+        template<typename T>
+        [[nodiscard]] inline auto get_field_type_layout() noexcept -> const TypeLayout& {
+            return layout_slot<T>.get();
+        }
+    }// namespace detail
+}// namespace kstd::reflect
\ No newline at end of file
@@ -0,0 +1,178 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#pragma once
+
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <utility>
+
+#if !defined(COMPILER_MSVC) && !defined(PLATFORM_WINDOWS)
+#include <cxxabi.h>
+#endif
+
+namespace kstd::reflect {
+    namespace detail {
+        template<typename T>
+        [[nodiscard]] constexpr auto get_function_signature() noexcept -> std::string_view {
+#if defined(COMPILER_MSVC)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        // The signature of a known type tells us where the type name starts and how much follows it
+        constexpr std::string_view probe_type_name = "double";
+        constexpr auto probe_signature = get_function_signature<double>();
+        constexpr usize type_name_prefix = probe_signature.find(probe_type_name);
+        constexpr usize type_name_suffix = probe_signature.size() - type_name_prefix - probe_type_name.size();
+
+        template<typename T>
+        [[nodiscard]] constexpr auto extract_type_name() noexcept -> std::string_view {
+            constexpr auto signature = get_function_signature<T>();
+            return signature.substr(type_name_prefix, signature.size() - type_name_prefix - type_name_suffix);
+        }
+
+        // Copies the name out of the signature, so only the name itself ends up in the binary
+        template<typename T, usize... INDICES>
+        [[nodiscard]] constexpr auto make_type_name_storage(std::index_sequence<INDICES...>) noexcept
+                -> std::array<char, sizeof...(INDICES) + 1> {
+            return {extract_type_name<T>()[INDICES]..., '\0'};
+        }
+
+        template<typename T>
+        inline constexpr auto type_name_storage =
+                make_type_name_storage<T>(std::make_index_sequence<extract_type_name<T>().size()>());
+
+        template<typename T>
+        [[nodiscard]] inline auto get_mangled_type_name() noexcept -> std::string_view {
+#if defined(COMPILER_MSVC) || (defined(PLATFORM_WINDOWS) && defined(COMPILER_CLANG))
+            return typeid(T).raw_name();// MSVC provides its own field for the mangled name
+#else
+            return typeid(T).name();
+#endif
+        }
+
+        template<typename T>
+        [[nodiscard]] inline auto demangle_type_name() noexcept -> Result<std::string> {
+#if defined(COMPILER_MSVC) || (defined(PLATFORM_WINDOWS) && defined(COMPILER_CLANG))
+            return std::string {typeid(T).name()};// MSVC uses the regular name field for the unmangled name
+#else
+            using namespace std::string_literals;
+            i32 status = 0;
+            auto* ptr = abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status);
+
+            switch(status) {
+                case -1: return Error {"Could not allocate memory to demangle"s};
+                case -2: return Error {"Not a valid mangled name"s};
+                case -3: return Error {"Invalid argument"s};
+                default: break;
+            }
+
+            std::string result {ptr};
+            free(ptr);    // Since __cxa_demangle malloc's it's result, we need to free it
+            return result;// MoR
+#endif
+        }
+    }// namespace detail
+
+    /**
+     * The human readable name of the given type, extracted from the
+     * signature of a function template at compile time.
+     */
+    template<typename T>
+    inline constexpr std::string_view type_name_v {detail::type_name_storage<T>.data(),
+                                                   detail::type_name_storage<T>.size() - 1};
+
+    namespace detail {
+        // How GCC, Clang and MSVC spell anonymous namespaces in type names
+        constexpr std::array<std::string_view, 3> anonymous_namespace_markers {"{anonymous}", "(anonymous namespace)",
+                                                                               "`anonymous namespace'"};
+
+        // Searches the signature rather than type_name_v, GCC does not treat the latter as constant with UBSan
+        template<typename T>
+        [[nodiscard]] constexpr auto is_internal_type() noexcept -> bool {
+            for(const auto marker : anonymous_namespace_markers) {
+                if(extract_type_name<T>().find(marker) != std::string_view::npos) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * True for types declared in an anonymous namespace. Their names are
+         * not unique, another translation unit may declare a different
+         * type with the very same name.
+         */
+        template<typename T>
+        inline constexpr bool is_internal_type_v = is_internal_type<T>();
+
+        // This function has internal linkage for internal types, so every translation unit gets its own copy
+        template<typename T>
+        [[nodiscard]] inline auto get_internal_type_name() noexcept -> std::string_view {
+            static const auto s_name = std::string {type_name_v<T>} + "@" +
+                                       std::to_string(reinterpret_cast<std::uintptr_t>(&s_name));// NOLINT
+            return s_name;
+        }
+    }// namespace detail
+
+    /**
+     * The name under which the given type and its members are registered.
+     * Equal to type_name_v for most types, types in anonymous namespaces
+     * get a suffix unique to their translation unit, so same-named types
+     * from different translation units don't share one RTTI.
+     */
+    template<typename T>
+    [[nodiscard]] inline auto get_type_key_name() noexcept -> std::string_view {
+        if constexpr(detail::is_internal_type_v<T>) {
+            return detail::get_internal_type_name<T>();
+        }
+        else {
+            return type_name_v<T>;
+        }
+    }
+
+    namespace detail {
+        template<typename T>
+        [[nodiscard]] inline auto get_type_name() noexcept -> Result<std::string_view> {
+#if defined(KSTD_REFLECT_USE_DEMANGLER)
+            // Cross-checking path, demangles once per type and keeps the result alive for the process
+            static const auto s_result = demangle_type_name<T>();
+
+            if(!s_result) {
+                return s_result.template forward<std::string_view>();
+            }
+
+            return std::string_view {*s_result};
+#else
+            return type_name_v<T>;
+#endif
+        }
+    }// namespace detail
+}// namespace kstd::reflect
\ No newline at end of file
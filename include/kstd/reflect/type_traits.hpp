@@ -0,0 +1,104 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+
+#include <type_traits>
+
+namespace kstd::reflect {
+    namespace detail {
+        // Excludes void, functions, references and arrays of unknown bound
+        template<typename T>
+        constexpr bool is_sized_object_v = std::is_object_v<T> && !(std::is_array_v<T> && std::extent_v<T> == 0);
+    }// namespace detail
+
+    /**
+     * Properties of a type which generic code can branch on without knowing the type
+     * statically, e.g. to copy trivially copyable values with memcpy. Size and alignment
+     * are 0 for types which have none, like void, functions and references.
+     */
+    struct TypeTraits final {
+        usize size;
+        u32 alignment;
+        [[maybe_unused]] bool is_primitive : 1;
+        [[maybe_unused]] bool is_integral : 1;
+        [[maybe_unused]] bool is_floating_point : 1;
+        [[maybe_unused]] bool is_enum : 1;
+        [[maybe_unused]] bool is_pointer : 1;
+        [[maybe_unused]] bool is_reference : 1;
+        [[maybe_unused]] bool is_array : 1;
+        [[maybe_unused]] bool is_function : 1;
+        [[maybe_unused]] bool is_class : 1;
+        [[maybe_unused]] bool is_polymorphic : 1;
+        [[maybe_unused]] bool is_abstract : 1;
+        [[maybe_unused]] bool is_const : 1;
+        [[maybe_unused]] bool is_volatile : 1;
+        [[maybe_unused]] bool is_standard_layout : 1;
+        [[maybe_unused]] bool is_pod : 1;
+        [[maybe_unused]] bool is_trivially_copyable : 1;
+        [[maybe_unused]] bool is_trivially_destructible : 1;
+        [[maybe_unused]] bool is_trivially_default_constructible : 1;
+        [[maybe_unused]] bool is_default_constructible : 1;
+        [[maybe_unused]] bool is_copy_constructible : 1;
+        [[maybe_unused]] bool is_move_constructible : 1;
+        [[maybe_unused]] bool is_destructible : 1;
+    };
+
+    template<typename T>
+    [[nodiscard]] constexpr auto make_type_traits() noexcept -> TypeTraits {
+        TypeTraits traits {};
+
+        if constexpr(detail::is_sized_object_v<T>) {
+            traits.size = sizeof(T);
+            traits.alignment = static_cast<u32>(alignof(T));
+        }
+
+        traits.is_primitive = std::is_integral_v<T> || std::is_floating_point_v<T>;
+        traits.is_integral = std::is_integral_v<T>;
+        traits.is_floating_point = std::is_floating_point_v<T>;
+        traits.is_enum = std::is_enum_v<T>;
+        traits.is_pointer = std::is_pointer_v<T>;
+        traits.is_reference = std::is_reference_v<T>;
+        traits.is_array = std::is_array_v<T>;
+        traits.is_function = std::is_function_v<T>;
+        traits.is_class = std::is_class_v<T>;
+        traits.is_const = std::is_const_v<T>;
+        traits.is_volatile = std::is_volatile_v<T>;
+
+        // These require a complete object type
+        if constexpr(detail::is_sized_object_v<T>) {
+            traits.is_polymorphic = std::is_polymorphic_v<T>;
+            traits.is_abstract = std::is_abstract_v<T>;
+            traits.is_standard_layout = std::is_standard_layout_v<T>;
+            traits.is_pod = std::is_trivial_v<T> && std::is_standard_layout_v<T>;
+            traits.is_trivially_copyable = std::is_trivially_copyable_v<T>;
+            traits.is_trivially_destructible = std::is_trivially_destructible_v<T>;
+            traits.is_trivially_default_constructible = std::is_trivially_default_constructible_v<T>;
+            traits.is_default_constructible = std::is_default_constructible_v<T>;
+            traits.is_copy_constructible = std::is_copy_constructible_v<T>;
+            traits.is_move_constructible = std::is_move_constructible_v<T>;
+            traits.is_destructible = std::is_destructible_v<T>;
+        }
+
+        return traits;
+    }
+}// namespace kstd::reflect
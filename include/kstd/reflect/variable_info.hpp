@@ -22,10 +22,12 @@
 #include <fmt/format.h>
 #include <kstd/defaults.hpp>
 #include <string>
+#include <string_view>
 
 #include "element_type.hpp"
 #include "reflection_fwd.hpp"
 #include "rtti.hpp"
+#include "string_pool.hpp"
 
 namespace kstd::reflect {
     template<typename T>
@@ -36,17 +38,17 @@ namespace kstd::reflect {
         using Self = VariableInfo<Type>;
 
         protected:
-        std::string _name;// NOLINT
+        std::string_view _name;// NOLINT - interned
 
-        [[nodiscard]] inline auto strip_name(const std::string& name) noexcept -> std::string {
-            std::string result {name};
+        [[nodiscard]] static inline auto strip_name(std::string_view name) noexcept -> std::string_view {
+            auto result = name;
 
-            if(name.find(".") != std::string::npos) {// Strip field refs
+            if(name.find('.') != std::string_view::npos) {// Strip field refs
                 const auto index = result.find_last_of('.');
                 result = result.substr(index + 1);
             }
 
-            if(name.find("::") != std::string::npos) {// Name contains namespace qualifier(s)
+            if(name.find("::") != std::string_view::npos) {// Name contains namespace qualifier(s)
                 const auto index = result.find_last_of("::");
                 result = result.substr(index + 1);// Strip off namespace qualifier(s)
             }
@@ -54,12 +56,19 @@ namespace kstd::reflect {
             return result;
         }
 
+        // The stripped name shares the storage of the interned qualified name
+        [[nodiscard]] static inline auto intern_name(std::string_view name) noexcept -> std::string_view {
+            const auto stripped = strip_name(name);
+            const auto offset = static_cast<usize>(stripped.data() - name.data());
+            return get_string_pool().intern_substring(name, offset, stripped.size());
+        }
+
         public:
         KSTD_DEFAULT_MOVE_COPY(VariableInfo, Self)
 
-        VariableInfo(std::string mangled_type_name, std::string type_name, const std::string& name) noexcept :
-                TypeInfo<Type>(std::move(mangled_type_name), std::move(type_name)),
-                _name {strip_name(name)} {
+        VariableInfo(std::string_view mangled_type_name, std::string_view type_name, std::string_view name) noexcept :
+                TypeInfo<Type>(mangled_type_name, type_name),
+                _name {intern_name(name)} {
         }
 
         ~VariableInfo() noexcept override = default;
@@ -72,17 +81,21 @@ namespace kstd::reflect {
             return fmt::format("{}:{}", _name, this->get_mangled_type_name());
         }
 
-        [[nodiscard]] auto is_same(const RTTI& other) const noexcept -> bool override {
-            return other.get_element_type() == ElementType::VARIABLE && *(other.template as_variable<T>()) == *this;
+        [[nodiscard]] auto is_equivalent(const RTTI& other) const noexcept -> bool override {
+            if(other.get_element_type() != ElementType::VARIABLE) {
+                return false;
+            }
+            const auto& variable = *(other.template as_variable<T>());
+            return _name == variable._name && this->get_mangled_type_name() == other.get_mangled_type_name();
         }
 
-        [[nodiscard]] inline auto get_name() const noexcept -> const std::string& {
+        [[nodiscard]] inline auto get_name() const noexcept -> std::string_view {
             return _name;
         }
 
         template<typename O>
         [[nodiscard]] inline auto operator==(const VariableInfo<O>& other) const noexcept -> bool {
-            return this->get_mangled_type_name() == other.get_mangled_type_name() && _name == other._name;
+            return this->is_same(other);
         }
     };
 }// namespace kstd::reflect
\ No newline at end of file
@@ -18,6 +18,13 @@
  */
 
 #include "foo_types.hpp"
+#include <kstd/reflect/reflection.hpp>
+
+namespace {
+    struct LocalStruct final {
+        [[maybe_unused]] kstd::u8 value = 0;
+    };
+}// namespace
 
 namespace foo {
     auto TestStruct::member_function(void* param1, kstd::i32& param2) const noexcept -> kstd::u32 {
@@ -27,4 +34,16 @@ namespace foo {
     auto test_function(kstd::i32 param1, void* param2, bool param3) noexcept -> kstd::u32 {
         return param1 >> 2;
     }
+
+    auto lookup_test_struct_from_other_tu() noexcept -> const kstd::reflect::RTTI& {
+        return *KSTD_LOOKUP_TYPE(TestStruct);
+    }
+
+    auto lookup_local_struct_from_other_tu() noexcept -> const kstd::reflect::RTTI& {
+        return *KSTD_LOOKUP_TYPE(LocalStruct);
+    }
+
+    auto lookup_local_struct_field_from_other_tu() noexcept -> const kstd::reflect::RTTI& {
+        return *KSTD_LOOKUP_FIELD_T(LocalStruct, value);
+    }
 }// namespace foo
\ No newline at end of file
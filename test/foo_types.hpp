@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <kstd/reflect/rtti.hpp>
 #include <kstd/types.hpp>
 
 namespace foo {
@@ -35,4 +36,11 @@ namespace foo {
 
     auto test_function([[maybe_unused]] kstd::i32 param1, [[maybe_unused]] void* param2,
                        [[maybe_unused]] bool param3) noexcept -> kstd::u32;
+
+    // Looked up from within foo_types.cpp to verify the registry is shared between translation units
+    auto lookup_test_struct_from_other_tu() noexcept -> const kstd::reflect::RTTI&;
+
+    // Looks up {anonymous}::LocalStruct from foo_types.cpp, which is a different type than any LocalStruct elsewhere
+    auto lookup_local_struct_from_other_tu() noexcept -> const kstd::reflect::RTTI&;
+    auto lookup_local_struct_field_from_other_tu() noexcept -> const kstd::reflect::RTTI&;
 }// namespace foo
\ No newline at end of file
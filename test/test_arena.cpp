@@ -0,0 +1,64 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include "foo_types.hpp"
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+
+TEST(kstd_reflect, test_arena_allocate) {
+    kstd::reflect::Arena arena;
+    ASSERT_EQ(arena.get_chunk_count(), 0);
+
+    auto* first = static_cast<kstd::u8*>(arena.allocate(3, 1));
+    auto* second = static_cast<kstd::u8*>(arena.allocate(8, 8));
+    auto* aligned = static_cast<kstd::u8*>(arena.allocate(64, 64));
+
+    ASSERT_EQ(arena.get_chunk_count(), 1);
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(second) % 8, 0);  // NOLINT
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(aligned) % 64, 0);// NOLINT
+    ASSERT_GE(second, first + 3);                              // NOLINT
+
+    // Oversized allocations get their own chunk without abandoning the current one
+    auto* large = arena.allocate(1024 * 1024, 16);
+    auto* next = static_cast<kstd::u8*>(arena.allocate(8, 8));
+    ASSERT_NE(large, nullptr);
+    ASSERT_EQ(arena.get_chunk_count(), 2);
+    ASSERT_EQ(next, aligned + 64);// NOLINT
+}
+
+TEST(kstd_reflect, test_arena_registry_values) {
+    using namespace kstd::reflect;
+    Registry registry;
+    constexpr RegistryKey key {ElementType::TYPE, {}, type_name_v<foo::TestStruct>, {}};
+    const auto& global_info = *KSTD_LOOKUP_TYPE(foo::TestStruct);
+
+    auto value = registry.create<TypeInfo<foo::TestStruct>>(global_info.get_mangled_type_name(),
+                                                            global_info.get_type_name());
+    ASSERT_TRUE(value.get_deleter().is_arena);
+    const auto* created = value.get();
+    ASSERT_EQ(&registry.insert(key, std::move(value)), created);
+    ASSERT_EQ(registry.get_arena().get_chunk_count(), 1);
+
+    // A value losing against an existing one is destroyed, its memory stays with the arena
+    auto duplicate = registry.create<TypeInfo<foo::TestStruct>>(global_info.get_mangled_type_name(),
+                                                                global_info.get_type_name());
+    ASSERT_EQ(&registry.insert(key, std::move(duplicate)), created);
+    ASSERT_EQ(registry.get_size(), 1);
+}
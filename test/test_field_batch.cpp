@@ -0,0 +1,134 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Row final {
+        kstd::u16 kind;
+        kstd::u32 id;
+        kstd::f64 value;
+        std::string label;
+    };
+
+    // Counts which are no multiple of the vector width exercise the scalar tail
+    constexpr kstd::usize row_count = 37;
+
+    auto make_rows() noexcept -> std::vector<Row> {
+        std::vector<Row> rows(row_count);
+
+        for(kstd::usize index = 0; index < row_count; ++index) {
+            rows[index] = {static_cast<kstd::u16>(index), static_cast<kstd::u32>(index * 3),
+                           static_cast<kstd::f64>(index) * 0.25, std::to_string(index)};
+        }
+
+        return rows;
+    }
+}// namespace
+
+TEST(kstd_reflect, test_field_gather) {
+    const auto rows = make_rows();
+    std::vector<kstd::u32> ids(row_count);
+    std::vector<kstd::f64> values(row_count);
+    std::vector<kstd::u16> kinds(row_count);
+    std::vector<std::string> labels(row_count);
+
+    KSTD_LOOKUP_FIELD_T(Row, id)->gather(rows.data(), row_count, ids.data());
+    KSTD_LOOKUP_FIELD_T(Row, value)->gather(rows.data(), sizeof(Row), row_count, values.data());
+    KSTD_LOOKUP_FIELD_T(Row, kind)->gather(rows.data(), row_count, kinds.data());
+    KSTD_LOOKUP_FIELD_T(Row, label)->gather(rows.data(), row_count, labels.data());
+
+    for(kstd::usize index = 0; index < row_count; ++index) {
+        ASSERT_EQ(ids[index], rows[index].id);
+        ASSERT_EQ(values[index], rows[index].value);
+        ASSERT_EQ(kinds[index], rows[index].kind);
+        ASSERT_EQ(labels[index], rows[index].label);
+    }
+}
+
+TEST(kstd_reflect, test_field_scatter) {
+    auto rows = make_rows();
+    std::vector<kstd::u32> ids(row_count);
+    std::vector<kstd::f64> values(row_count);
+    std::vector<std::string> labels(row_count);
+
+    for(kstd::usize index = 0; index < row_count; ++index) {
+        ids[index] = static_cast<kstd::u32>(1000 + index);
+        values[index] = static_cast<kstd::f64>(index) * -2.0;
+        labels[index] = "label " + std::to_string(index);
+    }
+
+    KSTD_LOOKUP_FIELD_T(Row, id)->scatter(rows.data(), row_count, ids.data());
+    KSTD_LOOKUP_FIELD_T(Row, value)->scatter(rows.data(), sizeof(Row), row_count, values.data());
+    KSTD_LOOKUP_FIELD_T(Row, label)->scatter(rows.data(), row_count, labels.data());
+
+    for(kstd::usize index = 0; index < row_count; ++index) {
+        ASSERT_EQ(rows[index].id, ids[index]);
+        ASSERT_EQ(rows[index].value, values[index]);
+        ASSERT_EQ(rows[index].label, labels[index]);
+        ASSERT_EQ(rows[index].kind, index);// Neighbouring fields stay untouched
+    }
+}
+
+TEST(kstd_reflect, test_field_gather_dense) {
+    struct Value final {
+        kstd::u64 value;
+    };
+
+    std::vector<Value> values {{1}, {2}, {3}};
+    std::vector<kstd::u64> result(values.size());
+    const auto& info = *KSTD_LOOKUP_FIELD_T(Value, value);
+    info.gather(values.data(), values.size(), result.data());
+    ASSERT_EQ(result, (std::vector<kstd::u64> {1, 2, 3}));
+
+    result = {4, 5, 6};
+    info.scatter(values.data(), values.size(), result.data());
+    ASSERT_EQ(values[2].value, 6);
+}
+
+TEST(kstd_reflect, test_field_gather_lanes) {
+#if defined(KSTD_REFLECT_HAS_GATHER)
+    if(!kstd::reflect::detail::has_avx2()) {
+        GTEST_SKIP() << "AVX2 is not supported by this CPU";
+    }
+
+    const auto rows = make_rows();
+    const auto* id_bytes = reinterpret_cast<const kstd::u8*>(&rows[0].id);      // NOLINT
+    const auto* value_bytes = reinterpret_cast<const kstd::u8*>(&rows[0].value);// NOLINT
+    std::vector<kstd::u32> ids(row_count);
+    std::vector<kstd::f64> values(row_count);
+
+    // Only whole vectors are gathered, the caller handles the tail
+    const auto id_count = kstd::reflect::detail::gather_lanes(id_bytes, sizeof(Row), row_count, ids.data());
+    const auto value_count = kstd::reflect::detail::gather_lanes(value_bytes, sizeof(Row), row_count, values.data());
+    ASSERT_EQ(id_count, row_count / 4 * 4);
+    ASSERT_EQ(value_count, row_count / 4 * 4);
+
+    for(kstd::usize index = 0; index < id_count; ++index) {
+        ASSERT_EQ(ids[index], rows[index].id);
+        ASSERT_EQ(values[index], rows[index].value);
+    }
+#else
+    GTEST_SKIP() << "No vector path on this platform";
+#endif
+}
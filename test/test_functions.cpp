@@ -20,6 +20,11 @@
 #include "foo_types.hpp"
 #include <gtest/gtest.h>
 #include <kstd/reflect/reflection.hpp>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 TEST(kstd_reflect, test_global_functions) {
     const auto info = KSTD_LOOKUP_FUN(foo::test_function);
@@ -44,4 +49,266 @@ TEST(kstd_reflect, test_member_functions) {
     ASSERT_EQ(info->get_param<0>(), *KSTD_LOOKUP_TYPE(void*));
     ASSERT_EQ(info->get_param<1>(), *KSTD_LOOKUP_TYPE(kstd::i32&));
     ASSERT_EQ(info->get_return_type(), *KSTD_LOOKUP_TYPE(kstd::u32));
-}
\ No newline at end of file
+
+    const kstd::reflect::RTTI& rtti = *info;
+    ASSERT_FALSE((rtti.as_function<kstd::u32, void*, kstd::i32&>()));
+    ASSERT_TRUE((rtti.as_member_function<foo::TestStruct, kstd::u32, void*, kstd::i32&>()));
+}
+
+TEST(kstd_reflect, test_global_function_invoke) {
+    const auto& info = *KSTD_LOOKUP_FUN(foo::test_function);
+    ASSERT_EQ(info.get_function(), &foo::test_function);
+    ASSERT_EQ(info.invoke(64, nullptr, true), 16U);
+
+    kstd::i32 param1 = 128;
+    void* param2 = nullptr;
+    bool param3 = false;
+    void* const args[] {&param1, &param2, &param3};
+    kstd::u32 result = 0;
+    info.invoke_erased(&result, args);
+    ASSERT_EQ(result, 32U);
+    info.get_invoker()(info, nullptr, args);// Discarding the result must be allowed
+}
+
+TEST(kstd_reflect, test_member_function_invoke) {
+    const auto& info = *KSTD_LOOKUP_FUN_M(foo::TestStruct::member_function);
+    ASSERT_TRUE(info.is_const());
+
+    const foo::TestStruct instance {};
+    kstd::i32 param2 = 4;
+    ASSERT_EQ(info.invoke(instance, nullptr, param2), 16U);
+
+    void* param1 = nullptr;
+    void* const args[] {const_cast<foo::TestStruct*>(&instance), &param1, &param2};// NOLINT
+    kstd::u32 result = 0;
+    info.invoke_erased(&result, args);
+    ASSERT_EQ(result, 16U);
+}
+
+namespace {
+    auto consume_pointer(std::unique_ptr<kstd::i32> value) noexcept -> kstd::i32 {
+        return *value;
+    }
+
+    struct Sink final {
+        kstd::i32 total = 0;
+
+        auto take(std::unique_ptr<kstd::i32> value) noexcept -> kstd::i32 {
+            return total += *value;
+        }
+    };
+}// namespace
+
+TEST(kstd_reflect, test_function_invoke_move_only_params) {
+    const auto& info = *KSTD_LOOKUP_FUN(consume_pointer);
+    ASSERT_EQ(info.invoke(std::make_unique<kstd::i32>(3)), 3);
+
+    auto param = std::make_unique<kstd::i32>(5);
+    void* const args[] {&param};
+    kstd::i32 result = 0;
+    info.invoke_erased(&result, args);
+    ASSERT_EQ(result, 5);
+    ASSERT_EQ(param, nullptr);// By-value parameters are moved from their argument
+
+    const auto& member_info = *KSTD_LOOKUP_FUN_M(Sink::take);
+    Sink sink {};
+    ASSERT_EQ(member_info.invoke(sink, std::make_unique<kstd::i32>(2)), 2);
+
+    param = std::make_unique<kstd::i32>(7);
+    void* const member_args[] {&sink, &param};
+    member_info.invoke_erased(&result, member_args);
+    ASSERT_EQ(result, 9);
+    ASSERT_EQ(param, nullptr);
+}
+
+namespace {
+    // Whether the given info can invoke its function on an instance of the given kind
+    template<typename INFO, typename INSTANCE, typename ARGS, typename = void>
+    struct IsInvocableOn : std::false_type {};
+
+    template<typename INFO, typename INSTANCE, typename... ARGS>
+    struct IsInvocableOn<INFO, INSTANCE, kstd::Pack<ARGS...>,
+                         std::void_t<decltype(std::declval<const INFO&>().invoke(std::declval<INSTANCE>(),
+                                                                                 std::declval<ARGS>()...))>>
+            : std::true_type {};
+
+    struct Counter final {
+        kstd::i32 value = 0;
+
+        auto add(kstd::i32 amount) noexcept -> void {
+            value += amount;
+        }
+
+        auto get_value() noexcept -> kstd::i32& {
+            return value;
+        }
+    };
+}// namespace
+
+TEST(kstd_reflect, test_member_function_invoke_mutable) {
+    const auto& add_info = *KSTD_LOOKUP_FUN_M(Counter::add);
+    const auto& get_info = *KSTD_LOOKUP_FUN_M(Counter::get_value);
+    ASSERT_FALSE(add_info.is_const());
+
+    Counter counter {};
+    add_info.invoke(counter, 2);
+
+    kstd::i32 amount = 3;
+    void* const args[] {&counter, &amount};
+    add_info.invoke_erased(nullptr, args);
+    ASSERT_EQ(counter.value, 5);
+
+    // Reference results are returned as a pointer to the referee
+    kstd::i32* result = nullptr;
+    get_info.invoke_erased(&result, args);
+    ASSERT_EQ(result, &counter.value);
+    ASSERT_EQ(&get_info.invoke(counter), &counter.value);
+
+    // Mutating member functions must not be invoked on const instances
+    using AddInfo = std::decay_t<decltype(add_info)>;
+    static_assert(IsInvocableOn<AddInfo, Counter&, kstd::Pack<kstd::i32>>::value);
+    static_assert(!IsInvocableOn<AddInfo, const Counter&, kstd::Pack<kstd::i32>>::value);
+}
+namespace {
+    struct LazyParam final {
+        kstd::i32 value;
+    };
+
+    struct LazyResult final {
+        kstd::i32 value;
+    };
+
+    [[maybe_unused]] auto lazy_function(LazyParam param) noexcept -> LazyResult {
+        return {param.value};
+    }
+}// namespace
+
+TEST(kstd_reflect, test_function_signature_lazy) {
+    using namespace kstd::reflect;
+    const auto& info = *KSTD_LOOKUP_FUN(lazy_function);
+    ASSERT_EQ(detail::type_slot<LazyParam>.load(), nullptr);
+    ASSERT_EQ(detail::type_slot<LazyResult>.load(), nullptr);
+
+    // Every thread has to observe the same, fully resolved signature
+    std::vector<std::thread> threads;
+    std::vector<const RTTI*> params(4);
+    for(kstd::usize index = 0; index < params.size(); ++index) {
+        threads.emplace_back([&info, &params, index] {
+            params[index] = info.get_param_types()[0];
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    for(const auto* param : params) {
+        ASSERT_EQ(param, &*KSTD_LOOKUP_TYPE(LazyParam));
+    }
+    ASSERT_EQ(info.get_return_type(), *KSTD_LOOKUP_TYPE(LazyResult));
+    ASSERT_TRUE(info.has_signature());
+}
+
+namespace {
+    struct Qualified final {
+        kstd::i32 value = 1;
+
+        auto get_lvalue(kstd::i32 offset) & noexcept -> kstd::i32 {
+            return value + offset;
+        }
+
+        auto get_rvalue(kstd::i32 offset) && -> kstd::i32 {
+            return value * offset;
+        }
+
+        auto get_volatile() const volatile noexcept -> kstd::i32 {
+            return value;
+        }
+
+        auto get_const_lvalue() const& -> kstd::i32 {
+            return -value;
+        }
+
+        auto get_const_rvalue() const&& -> kstd::i32 {
+            return value * value;
+        }
+    };
+}// namespace
+
+TEST(kstd_reflect, test_function_flags) {
+    const auto& free_info = *KSTD_LOOKUP_FUN(lazy_function);
+    ASSERT_TRUE(free_info.get_flags().is_noexcept);
+    ASSERT_FALSE(free_info.get_flags().is_const);
+
+    const auto& lvalue_info = *KSTD_LOOKUP_FUN_M(Qualified::get_lvalue);
+    ASSERT_TRUE(lvalue_info.get_flags().is_noexcept);
+    ASSERT_TRUE(lvalue_info.get_flags().is_lvalue_ref);
+    ASSERT_FALSE(lvalue_info.get_flags().is_rvalue_ref);
+    ASSERT_FALSE(lvalue_info.is_const());
+
+    const auto& rvalue_info = *KSTD_LOOKUP_FUN_M(Qualified::get_rvalue);
+    ASSERT_FALSE(rvalue_info.get_flags().is_noexcept);
+    ASSERT_TRUE(rvalue_info.get_flags().is_rvalue_ref);
+
+    const auto& volatile_info = *KSTD_LOOKUP_FUN_M(Qualified::get_volatile);
+    ASSERT_TRUE(volatile_info.is_const());
+    ASSERT_TRUE(volatile_info.is_volatile());
+    ASSERT_FALSE(volatile_info.get_flags().is_lvalue_ref);
+
+    const auto& const_info = *KSTD_LOOKUP_FUN_M(Qualified::get_const_lvalue);
+    ASSERT_TRUE(const_info.is_const());
+    ASSERT_TRUE(const_info.get_flags().is_lvalue_ref);
+    ASSERT_NE(&const_info, &*KSTD_LOOKUP_FUN_M(Qualified::get_volatile));
+}
+
+TEST(kstd_reflect, test_qualified_member_function_invoke) {
+    Qualified instance {};
+    instance.value = 3;
+    const auto& lvalue_info = *KSTD_LOOKUP_FUN_M(Qualified::get_lvalue);
+    const auto& rvalue_info = *KSTD_LOOKUP_FUN_M(Qualified::get_rvalue);
+    const auto& volatile_info = *KSTD_LOOKUP_FUN_M(Qualified::get_volatile);
+    const auto& const_info = *KSTD_LOOKUP_FUN_M(Qualified::get_const_lvalue);
+
+    ASSERT_EQ(lvalue_info.invoke(instance, 2), 5);
+    ASSERT_EQ(rvalue_info.invoke(instance, 2), 6);
+    ASSERT_EQ(volatile_info.invoke(instance), 3);
+
+    const auto& const_instance = instance;
+    ASSERT_EQ(const_info.invoke(const_instance), -3);
+    ASSERT_EQ(volatile_info.invoke(const_instance), 3);
+
+    kstd::i32 offset = 4;
+    void* const args[] {&instance, &offset};
+    kstd::i32 result = 0;
+    rvalue_info.invoke_erased(&result, args);
+    ASSERT_EQ(result, 12);
+    lvalue_info.invoke_erased(&result, args);
+    ASSERT_EQ(result, 7);
+    const_info.invoke_erased(&result, args);
+    ASSERT_EQ(result, -3);
+}
+
+TEST(kstd_reflect, test_qualified_member_function_const_instances) {
+    using LvalueInfo = std::decay_t<decltype(*KSTD_LOOKUP_FUN_M(Qualified::get_lvalue))>;
+    using RvalueInfo = std::decay_t<decltype(*KSTD_LOOKUP_FUN_M(Qualified::get_rvalue))>;
+    using VolatileInfo = std::decay_t<decltype(*KSTD_LOOKUP_FUN_M(Qualified::get_volatile))>;
+    using ConstLvalueInfo = std::decay_t<decltype(*KSTD_LOOKUP_FUN_M(Qualified::get_const_lvalue))>;
+    using ConstRvalueInfo = std::decay_t<decltype(*KSTD_LOOKUP_FUN_M(Qualified::get_const_rvalue))>;
+    using Offset = kstd::Pack<kstd::i32>;
+
+    // Non-const & and && functions mutate the instance, so const instances are rejected
+    static_assert(IsInvocableOn<LvalueInfo, Qualified&, Offset>::value);
+    static_assert(!IsInvocableOn<LvalueInfo, const Qualified&, Offset>::value);
+    static_assert(IsInvocableOn<RvalueInfo, Qualified&, Offset>::value);
+    static_assert(!IsInvocableOn<RvalueInfo, const Qualified&, Offset>::value);
+
+    static_assert(IsInvocableOn<VolatileInfo, const Qualified&, kstd::Pack<>>::value);
+    static_assert(IsInvocableOn<ConstLvalueInfo, const Qualified&, kstd::Pack<>>::value);
+    static_assert(!IsInvocableOn<ConstRvalueInfo, const Qualified&, kstd::Pack<>>::value);
+
+    Qualified instance {};
+    instance.value = 5;
+    const auto& const_rvalue_info = *KSTD_LOOKUP_FUN_M(Qualified::get_const_rvalue);
+    ASSERT_TRUE(const_rvalue_info.is_const());
+    ASSERT_TRUE(const_rvalue_info.get_flags().is_rvalue_ref);
+    ASSERT_EQ(const_rvalue_info.invoke(instance), 25);
+}
@@ -0,0 +1,185 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/json.hpp>
+#include <string>
+
+namespace {
+    struct Address final {
+        std::string city;
+        kstd::u16 zip;
+    };
+
+    struct Person final {
+        kstd::u64 id;
+        std::string name;
+        kstd::i8 level;
+        kstd::f64 score;
+        kstd::f32 ratio;
+        bool active;
+        Address address;
+    };
+
+    struct Versioned final {
+        const kstd::u32 version;
+        std::string label;
+    };
+
+    auto reflect_person() noexcept -> void {
+        (void) KSTD_REFLECT_STRUCT(Address, city, zip);
+        (void) KSTD_REFLECT_STRUCT(Person, id, name, level, score, ratio, active, address);
+    }
+}// namespace
+
+TEST(kstd_reflect, test_json_encode) {
+    reflect_person();
+    const Person person {42, "Jane \"JD\" Doe\n", -3, 0.5, 2.0F, true, {"Zürich", 8001}};
+
+    std::string buffer;
+    const auto result = kstd::reflect::encode_json(person, buffer);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(*result, buffer.size());
+    ASSERT_EQ(buffer, "{\"id\":42,\"name\":\"Jane \\\"JD\\\" Doe\\n\",\"level\":-3,\"score\":0.5,\"ratio\":2,"
+                      "\"active\":true,\"address\":{\"city\":\"Zürich\",\"zip\":8001}}");
+}
+
+TEST(kstd_reflect, test_json_round_trip) {
+    reflect_person();
+    const Person person {7, std::string(100, 'x') + "\t\x01", 127, -1.25e10, 0.125F, false, {"Berlin", 10115}};
+
+    std::string buffer;
+    ASSERT_TRUE(kstd::reflect::encode_json(person, buffer));
+
+    Person decoded {};
+    const auto result = kstd::reflect::decode_json(buffer, decoded);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(*result, buffer.size());
+    ASSERT_EQ(decoded.id, person.id);
+    ASSERT_EQ(decoded.name, person.name);
+    ASSERT_EQ(decoded.level, person.level);
+    ASSERT_EQ(decoded.score, person.score);
+    ASSERT_EQ(decoded.ratio, person.ratio);
+    ASSERT_EQ(decoded.active, person.active);
+    ASSERT_EQ(decoded.address.city, person.address.city);
+    ASSERT_EQ(decoded.address.zip, person.address.zip);
+}
+
+TEST(kstd_reflect, test_json_decode_unknown_keys) {
+    reflect_person();
+    const std::string json = R"( {
+        "tags": ["a", {"nested": [1, 2, "]}"]}, "\"quoted\""],
+        "name" : "Jérôme 😀",
+        "extra": {"deep": {"deeper": [true, false, null]}},
+        "score": 1e3,
+        "level": null,
+        "unknown": -12.5e-3
+    } trailing)";
+
+    Person person {};
+    person.level = 9;
+    const auto result = kstd::reflect::decode_json(json, person);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(json.substr(*result), " trailing");
+    ASSERT_EQ(person.name, "J\xC3\xA9r\xC3\xB4me \xF0\x9F\x98\x80");
+    ASSERT_EQ(person.score, 1000.0);
+    ASSERT_EQ(person.level, 9);
+}
+
+TEST(kstd_reflect, test_json_decode_errors) {
+    reflect_person();
+    Person person {};
+
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"level": 128})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"id": -1})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"name": 5})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"name": "unterminated)", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"extra": [1, 2})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"active": yes})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"id": 1 "name": "x"})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"([1, 2])", person));
+}
+
+TEST(kstd_reflect, test_json_decode_invalid_literals) {
+    reflect_person();
+    Person person {};
+
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"level": nope})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"level": nullx})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"active": trux})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"active": truex})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": nope})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": trux})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": fals})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": 12abc})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": yes})", person));
+
+    ASSERT_TRUE(kstd::reflect::decode_json(R"({"unknown": null, "other": true, "last": false})", person));
+    ASSERT_TRUE(kstd::reflect::decode_json(R"({"active": true,"level": null})", person));
+    ASSERT_TRUE(person.active);
+}
+
+TEST(kstd_reflect, test_json_decode_invalid_numbers) {
+    reflect_person();
+    Person person {};
+
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"score": inf})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"score": -inf})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"score": nan})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"score": 1.})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"score": .5})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"score": +1})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"score": 1e})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"score": 01})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"id": 1.5})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": 1.})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": 1-2})", person));
+
+    ASSERT_TRUE(kstd::reflect::decode_json(R"({"score": -0.5e+2, "ratio": 2E-1, "id": 0, "unknown": 1.5e3})", person));
+    ASSERT_EQ(person.score, -50.0);
+    ASSERT_EQ(person.ratio, 0.2F);
+    ASSERT_EQ(person.id, 0U);
+}
+
+TEST(kstd_reflect, test_json_decode_invalid_strings) {
+    reflect_person();
+    Person person {};
+
+    ASSERT_FALSE(kstd::reflect::decode_json("{\"name\": \"line\nbreak\"}", person));
+    ASSERT_FALSE(kstd::reflect::decode_json("{\"unknown\": \"tab\there\"}", person));
+    ASSERT_FALSE(kstd::reflect::decode_json("{\"unknown\": [\"a long string to skip\x01 in a container\"]}", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"name": "\udc00"})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"name": "\ud800"})", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": "\)", person));
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"unknown": ["\)", person));
+
+    ASSERT_TRUE(kstd::reflect::decode_json(R"({"name": "\ud83d\ude00\t"})", person));
+    ASSERT_EQ(person.name, "\xF0\x9F\x98\x80\t");
+}
+
+TEST(kstd_reflect, test_json_decode_skips_const_fields) {
+    ASSERT_TRUE(KSTD_REFLECT_STRUCT(Versioned, version, label));
+    Versioned versioned {1, "old"};
+
+    ASSERT_TRUE(kstd::reflect::decode_json(R"({"version": 2, "label": "new"})", versioned));
+    ASSERT_EQ(versioned.version, 1U);
+    ASSERT_EQ(versioned.label, "new");
+    ASSERT_FALSE(kstd::reflect::decode_json(R"({"version": 2.})", versioned));
+}
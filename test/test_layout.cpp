@@ -0,0 +1,144 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include "foo_types.hpp"
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+
+// Arrays would compare their addresses, so they get no equals operation
+static_assert(kstd::reflect::detail::IsEqualityComparable<std::string>::value);
+static_assert(!kstd::reflect::detail::IsEqualityComparable<kstd::u8[16]>::value);
+
+namespace {
+    struct Record final {
+        kstd::i32 id;
+        kstd::u32 flags;
+        kstd::f32 weight;
+        std::string name;
+        kstd::u64 timestamp;
+    };
+
+    auto register_record() noexcept -> const kstd::reflect::TypeInfo<Record>& {
+        // Registered out of order on purpose, the layout is sorted by offset
+        (void) KSTD_LOOKUP_FIELD_T(Record, timestamp);
+        (void) KSTD_LOOKUP_FIELD_T(Record, name);
+        (void) KSTD_LOOKUP_FIELD_T(Record, weight);
+        (void) KSTD_LOOKUP_FIELD_T(Record, flags);
+        (void) KSTD_LOOKUP_FIELD_T(Record, id);
+        return *KSTD_LOOKUP_TYPE(Record);
+    }
+}// namespace
+
+TEST(kstd_reflect, test_layout_fields) {
+    const auto& layout = register_record().get_layout();
+    const auto& fields = layout.get_fields();
+
+    ASSERT_EQ(fields.size(), 5);
+    ASSERT_EQ(fields[0].offset, offsetof(Record, id));
+    ASSERT_EQ(fields[3].offset, offsetof(Record, name));
+    ASSERT_EQ(fields[3].size, sizeof(std::string));
+    ASSERT_FALSE(fields[3].is_trivially_copyable);
+    ASSERT_EQ(fields[0].type_id, KSTD_LOOKUP_TYPE(kstd::i32)->get_hash());
+
+    // Looking a field up again must not add it twice
+    (void) KSTD_LOOKUP_FIELD_T(Record, id);
+    ASSERT_EQ(register_record().get_layout().get_fields().size(), 5);
+}
+
+TEST(kstd_reflect, test_layout_spans) {
+    const auto& layout = register_record().get_layout();
+
+    // id, flags and weight are copied as one span, only id and flags are compared bitwise
+    ASSERT_EQ(layout.get_copy_spans().size(), 2);
+    ASSERT_EQ(layout.get_copy_spans()[0].offset, offsetof(Record, id));
+    ASSERT_EQ(layout.get_copy_spans()[0].size, offsetof(Record, weight) + sizeof(kstd::f32));
+    ASSERT_EQ(layout.get_compare_spans()[0].size, offsetof(Record, weight));
+    ASSERT_TRUE(layout.is_copyable());
+    ASSERT_TRUE(layout.is_comparable());
+    ASSERT_TRUE(layout.is_hashable());
+    ASSERT_TRUE(layout.is_swappable());
+}
+
+TEST(kstd_reflect, test_layout_operations) {
+    const auto& info = register_record();
+    const Record first {1, 2, 3.0F, "first record with a heap allocated name", 4};
+    Record second {5, 6, 7.0F, "second", 8};
+
+    ASSERT_FALSE(*info.equals(first, second));
+    ASSERT_TRUE(info.copy(second, first));
+    ASSERT_TRUE(*info.equals(first, second));
+    ASSERT_EQ(second.name, first.name);
+    ASSERT_EQ(*info.hash(first), *info.hash(second));
+
+    Record third {9, 10, -0.0F, "third", 11};
+    second.weight = 0.0F;
+    ASSERT_TRUE(info.swap(second, third));
+    ASSERT_EQ(second.id, 9);
+    ASSERT_EQ(second.name, "third");
+    ASSERT_EQ(third.name, first.name);
+    ASSERT_EQ(third.timestamp, 4U);
+
+    // Floats are compared by value, not bitwise
+    third.weight = -0.0F;
+    ASSERT_TRUE(*info.equals(first, third) == (first.weight == third.weight));
+}
+
+namespace {
+    // Neither comparable nor hashable, but copyable and swappable
+    struct Opaque final {
+        std::string text;
+    };
+
+    struct OpaqueRecord final {
+        kstd::i32 id;
+        Opaque opaque;
+    };
+}// namespace
+
+TEST(kstd_reflect, test_layout_unsupported_operations) {
+    const auto& info = *KSTD_LOOKUP_TYPE(OpaqueRecord);
+    (void) KSTD_LOOKUP_FIELD_T(OpaqueRecord, id);
+    (void) KSTD_LOOKUP_FIELD_T(OpaqueRecord, opaque);
+    ASSERT_FALSE(info.get_layout().is_comparable());
+    ASSERT_FALSE(info.get_layout().is_hashable());
+
+    // Differing only in a field which can not be compared must not make them equal
+    const OpaqueRecord first {1, {"first"}};
+    OpaqueRecord second {1, {"second"}};
+    ASSERT_FALSE(info.equals(first, second));
+    ASSERT_FALSE(info.hash(first));
+
+    ASSERT_TRUE(info.copy(second, first));
+    ASSERT_EQ(second.opaque.text, "first");
+}
+
+TEST(kstd_reflect, test_layout_volatile_fields) {
+    const auto& info = *KSTD_LOOKUP_TYPE(foo::TestStruct);
+    (void) KSTD_LOOKUP_FIELD_T(foo::TestStruct, value1);
+    (void) KSTD_LOOKUP_FIELD_T(foo::TestStruct, value3);
+
+    const auto& layout = info.get_layout();
+    for(const auto& span : layout.get_copy_spans()) {
+        ASSERT_FALSE(span.offset <= offsetof(foo::TestStruct, value1) &&
+                     span.offset + span.size > offsetof(foo::TestStruct, value1));
+    }
+    ASSERT_FALSE(layout.is_copyable());// volatile std::string has no usable copy assignment
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include "foo_types.hpp"
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Config final {
+        kstd::u32 width;
+        kstd::u32 height;
+        std::string title;
+        bool fullscreen;
+    };
+
+    KSTD_STATIC_REFLECT_STRUCT(Config, width, height, title, fullscreen)
+
+    static_assert(kstd::reflect::static_type_info<Config>.find_field("width") == 0);
+    static_assert(kstd::reflect::static_type_info<Config>.find_field("fullscreen") == 3);
+    static_assert(kstd::reflect::static_type_info<Config>.find_field("depth") == 4);
+}// namespace
+
+TEST(kstd_reflect, test_member_index_find_field) {
+    const auto& type = *KSTD_LOOKUP_TYPE(foo::TestStruct);
+    const auto& field = *KSTD_LOOKUP_FIELD_T(foo::TestStruct, value1);
+
+    ASSERT_EQ(type.find_field("value1"), &field);
+    ASSERT_EQ(type.find_field("value1_"), nullptr);
+    ASSERT_EQ(type.find_function("value1"), nullptr);
+}
+
+TEST(kstd_reflect, test_member_index_find_function) {
+    const auto& type = *KSTD_LOOKUP_TYPE(foo::TestStruct);
+    const auto& function = *KSTD_LOOKUP_FUN_M(foo::TestStruct::member_function);
+
+    ASSERT_EQ(type.find_function("member_function"), &function);
+    ASSERT_EQ(type.find_field("member_function"), nullptr);
+    ASSERT_TRUE(type.get_members().is_perfect());
+}
+
+TEST(kstd_reflect, test_member_index_reflect_struct) {
+    const auto& type = *kstd::reflect::reflect_struct<Config>();
+
+    for(const auto* name : {"width", "height", "title", "fullscreen"}) {
+        const auto* field = type.find_field(name);
+        ASSERT_NE(field, nullptr);
+        ASSERT_EQ(field, type.get_field(type.get_fields()[kstd::reflect::static_type_info<Config>.find_field(name)]));
+    }
+
+    ASSERT_EQ(type.get_members().get_size(), 4);
+}
+
+TEST(kstd_reflect, test_member_index_perfect_hash) {
+    using namespace kstd::reflect;
+    std::vector<std::string> names;
+    std::vector<MemberEntry> members;
+
+    for(kstd::usize index = 0; index < 1000; ++index) {
+        names.push_back("member_" + std::to_string(index));
+    }
+
+    for(const auto& name : names) {
+        members.push_back({name, ElementType::FIELD, reinterpret_cast<const RTTI*>(&name)});// NOLINT
+    }
+
+    const MemberIndex index {nullptr, members};
+    ASSERT_TRUE(index.is_perfect());
+
+    for(const auto& name : names) {
+        ASSERT_EQ(index.find(name, ElementType::FIELD), reinterpret_cast<const RTTI*>(&name));// NOLINT
+    }
+
+    ASSERT_EQ(index.find("member_1000", ElementType::FIELD), nullptr);
+    ASSERT_EQ(index.find("member_1", ElementType::MEMBER_FUNCTION), nullptr);
+}
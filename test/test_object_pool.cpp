@@ -0,0 +1,181 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include "foo_types.hpp"
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+    struct Plugin final {
+        static inline kstd::i32 live_count = 0;// NOLINT
+
+        std::string name {"plugin"};
+        kstd::u64 id {42};
+
+        Plugin() noexcept {
+            ++live_count;
+        }
+
+        Plugin(const Plugin& other) noexcept :
+                name {other.name},
+                id {other.id} {
+            ++live_count;
+        }
+
+        ~Plugin() noexcept {
+            --live_count;
+        }
+    };
+
+    struct Fallible final {
+        std::string name;
+
+        Fallible() :
+                name {"may throw"} {
+        }
+    };
+
+    struct alignas(64) Aligned final {
+        kstd::u8 value;
+    };
+}// namespace
+
+TEST(kstd_reflect, test_object_pool) {
+    kstd::reflect::ObjectPool pool {sizeof(Aligned), alignof(Aligned)};
+    ASSERT_EQ(pool.get_slot_size(), 64);
+
+    auto* first = pool.allocate();
+    auto* second = pool.allocate();
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(first) % 64, 0); // NOLINT
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(second) % 64, 0);// NOLINT
+    ASSERT_EQ(pool.get_live_count(), 2);
+
+    // Freed slots are reused before the slab grows
+    pool.deallocate(first);
+    ASSERT_EQ(pool.allocate(), first);
+    ASSERT_EQ(pool.get_slab_count(), 1);
+    pool.deallocate(first);
+    pool.deallocate(second);
+    ASSERT_EQ(pool.get_live_count(), 0);
+}
+
+TEST(kstd_reflect, test_type_lifecycle) {
+    const auto& type = *KSTD_LOOKUP_TYPE(Plugin);
+    const auto* lifecycle = type.get_lifecycle();
+    ASSERT_NE(lifecycle, nullptr);
+    ASSERT_EQ(lifecycle->size, sizeof(Plugin));
+    ASSERT_NE(lifecycle->copy_construct, nullptr);
+
+    alignas(Plugin) kstd::u8 storage[sizeof(Plugin)];// NOLINT
+    type.construct_at(storage);
+    ASSERT_EQ(Plugin::live_count, 1);
+
+    alignas(Plugin) kstd::u8 copy[sizeof(Plugin)];// NOLINT
+    lifecycle->copy_construct(copy, storage);
+    ASSERT_EQ(reinterpret_cast<Plugin*>(copy)->name, "plugin");// NOLINT
+    ASSERT_EQ(Plugin::live_count, 2);
+
+    lifecycle->destruct(copy);
+    type.destruct_at(storage);
+    ASSERT_EQ(Plugin::live_count, 0);
+
+    // Only types have a lifecycle
+    const auto& field = *KSTD_LOOKUP_FIELD_T(foo::TestStruct, value1);
+    ASSERT_EQ(field.get_lifecycle(), nullptr);
+}
+
+TEST(kstd_reflect, test_type_lifecycle_throwing_constructors) {
+    const auto& type = *KSTD_LOOKUP_TYPE(Fallible);
+    const auto* lifecycle = type.get_lifecycle();
+    ASSERT_NE(lifecycle, nullptr);
+
+    // Thunks cannot throw, so constructors which may throw are not exposed
+    ASSERT_EQ(lifecycle->construct, nullptr);
+    ASSERT_EQ(lifecycle->copy_construct, nullptr);
+    ASSERT_NE(lifecycle->move_construct, nullptr);
+    ASSERT_FALSE(kstd::reflect::make_unique(static_cast<const kstd::reflect::RTTI&>(type)));
+}
+
+TEST(kstd_reflect, test_make_by_name) {
+    using namespace kstd::reflect;
+    (void) KSTD_LOOKUP_TYPE(Plugin);
+
+    const auto* type = get_registry().find({ElementType::TYPE, {}, get_type_key_name<Plugin>(), {}});
+    ASSERT_NE(type, nullptr);
+
+    {
+        auto unique_result = make_unique(*type);
+        ASSERT_TRUE(unique_result);
+        auto shared_result = make_shared(*type);
+        ASSERT_TRUE(shared_result);
+        ASSERT_EQ(static_cast<Plugin*>(unique_result->get())->id, 42);
+        ASSERT_EQ(static_cast<Plugin*>(shared_result->get())->name, "plugin");
+        ASSERT_EQ(Plugin::live_count, 2);
+    }
+
+    ASSERT_EQ(Plugin::live_count, 0);
+
+    const RTTI& void_type = *KSTD_LOOKUP_TYPE(void);
+    ASSERT_FALSE(make_unique(void_type));
+}
+
+TEST(kstd_reflect, test_make_typed) {
+    using namespace kstd::reflect;
+    const auto& type = *KSTD_LOOKUP_TYPE(Plugin);
+
+    {
+        auto unique = make_unique(type);
+        auto pooled = make_pooled(type);
+        auto shared = make_shared(type);
+        static_assert(std::is_same_v<decltype(unique), std::unique_ptr<Plugin>>);
+        ASSERT_EQ(unique->id, 42);
+        ASSERT_EQ(pooled->id, 42);
+        ASSERT_EQ(shared->name, "plugin");
+        ASSERT_EQ(Plugin::live_count, 3);
+    }
+
+    ASSERT_EQ(Plugin::live_count, 0);
+}
+
+TEST(kstd_reflect, test_make_across_threads) {
+    using namespace kstd::reflect;
+    const auto& type = *KSTD_LOOKUP_TYPE(Aligned);
+    auto& pool = get_object_pool<Aligned>();
+    std::vector<PoolPtr<Aligned>> objects;
+
+    // Slots cached by the thread are returned to the pool once it exits
+    std::thread {[&] {
+        for(kstd::usize index = 0; index < 100; ++index) {
+            objects.push_back(make_pooled(type));
+        }
+    }}.join();
+
+    ASSERT_EQ(pool.get_live_count(), 100);
+    objects.clear();
+
+    // Slots freed by this thread are kept, apart from whole batches handed back
+    ASSERT_LT(pool.get_live_count(), 100);
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(make_pooled(type).get()) % 64, 0);// NOLINT
+}
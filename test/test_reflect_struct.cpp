@@ -0,0 +1,73 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+
+namespace {
+    struct Position final {
+        kstd::f32 x;
+        kstd::f32 y;
+        kstd::f32 z;
+    };
+
+    struct Entity final {
+        kstd::u64 id;
+        std::string name;
+        Position position;
+        kstd::u32 flags;
+    };
+}// namespace
+
+TEST(kstd_reflect, test_reflect_struct) {
+    const auto result = KSTD_REFLECT_STRUCT(Entity, id, name, position, flags);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(&*result, &*KSTD_LOOKUP_TYPE(Entity));
+
+    const auto& fields = result->get_fields();
+    ASSERT_EQ(fields.size(), 4);
+    ASSERT_EQ(fields[0].name, "id");
+    ASSERT_EQ(fields[1].name, "name");
+    ASSERT_EQ(fields[2].name, "position");
+    ASSERT_EQ(fields[3].name, "flags");
+    ASSERT_EQ(fields[2].offset, offsetof(Entity, position));
+    ASSERT_EQ(fields[2].type_id, KSTD_LOOKUP_TYPE(Position)->get_hash());
+}
+
+TEST(kstd_reflect, test_reflect_struct_fields_are_registered) {
+    const auto& type = *KSTD_REFLECT_STRUCT(Entity, id, name, position, flags);
+    const auto& name_field = *KSTD_LOOKUP_FIELD_T(Entity, name);
+
+    // Looking a field up afterwards yields the instance registered in the batch
+    ASSERT_EQ(type.get_field(type.get_fields()[1]), &name_field);
+    ASSERT_EQ(name_field.get_offset(), offsetof(Entity, name));
+    ASSERT_EQ(&name_field.get_enclosing_type(), &type);
+    ASSERT_EQ(type.get_fields().size(), 4);
+}
+
+TEST(kstd_reflect, test_reflect_struct_after_lookup) {
+    const auto& y_field = *KSTD_LOOKUP_FIELD_T(Position, y);
+    const auto& type = *KSTD_REFLECT_STRUCT(Position, x, y, z);
+
+    ASSERT_EQ(type.get_fields().size(), 3);
+    ASSERT_EQ(type.get_field(type.get_fields()[1]), &y_field);
+    ASSERT_EQ(type.get_fields()[0].name, "x");
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include "foo_types.hpp"
+#include <algorithm>
+#include <array>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr kstd::usize thread_count = 8;
+    constexpr kstd::usize key_count = 4096;
+
+    // Shares its name with the LocalStruct in foo_types.cpp, but not its layout
+    struct LocalStruct final {
+        [[maybe_unused]] kstd::u64 value = 0;
+        [[maybe_unused]] kstd::u64 other_value = 0;
+    };
+}// namespace
+
+TEST(kstd_reflect, test_registry_concurrent_insert) {
+    kstd::reflect::Registry registry;
+    std::vector<std::string> keys;
+    keys.reserve(key_count);
+
+    for(kstd::usize index = 0; index < key_count; ++index) {
+        keys.push_back(fmt::format("key_{}", index));
+    }
+
+    std::vector<std::vector<const kstd::reflect::RTTI*>> results(thread_count);
+    std::vector<std::thread> threads;
+
+    for(kstd::usize thread_index = 0; thread_index < thread_count; ++thread_index) {
+        threads.emplace_back([&, thread_index] {
+            auto& thread_results = results[thread_index];
+            thread_results.resize(key_count);
+
+            std::vector<kstd::usize> order(key_count);
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), std::mt19937 {static_cast<kstd::u32>(thread_index)});
+
+            for(const auto index : order) {
+                const kstd::reflect::RegistryKey key {kstd::reflect::ElementType::TYPE, {}, keys[index], {}};
+                auto value = std::make_unique<kstd::reflect::TypeInfo<kstd::i32>>(keys[index], keys[index]);
+                thread_results[index] = &registry.insert(key, std::move(value));
+            }
+        });
+    }
+
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(registry.get_size(), key_count);
+
+    for(kstd::usize index = 0; index < key_count; ++index) {
+        const auto* expected = registry.find({kstd::reflect::ElementType::TYPE, {}, keys[index], {}});
+        ASSERT_NE(expected, nullptr);
+        ASSERT_EQ(expected->get_type_name(), keys[index]);
+
+        for(const auto& thread_results : results) {
+            ASSERT_EQ(thread_results[index], expected);
+        }
+    }
+
+    ASSERT_EQ(registry.find({kstd::reflect::ElementType::TYPE, {}, "missing", {}}), nullptr);
+}
+
+TEST(kstd_reflect, test_registry_concurrent_lookup) {
+    std::vector<std::array<const kstd::reflect::RTTI*, 4>> results(thread_count);
+    std::vector<std::thread> threads;
+
+    for(kstd::usize thread_index = 0; thread_index < thread_count; ++thread_index) {
+        threads.emplace_back([&, thread_index] {
+            for(kstd::usize iteration = 0; iteration < 1000; ++iteration) {
+                results[thread_index] = {&*KSTD_LOOKUP_TYPE(foo::TestStruct),
+                                         &*KSTD_LOOKUP_FIELD_T(foo::TestStruct, value1),
+                                         &*KSTD_LOOKUP_FUN(foo::test_function),
+                                         &*KSTD_LOOKUP_FUN_M(foo::TestStruct::member_function)};
+            }
+        });
+    }
+
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    for(const auto& thread_results : results) {
+        ASSERT_EQ(thread_results, results[0]);
+    }
+}
+
+TEST(kstd_reflect, test_registry_shared_between_translation_units) {
+    const kstd::reflect::RTTIRef local_ref = *KSTD_LOOKUP_TYPE(foo::TestStruct);
+    const kstd::reflect::RTTIRef other_ref = foo::lookup_test_struct_from_other_tu();
+    ASSERT_EQ(local_ref, other_ref);
+}
+
+TEST(kstd_reflect, test_registry_anonymous_types_not_shared_between_translation_units) {
+    const auto& local_type = *KSTD_LOOKUP_TYPE(LocalStruct);
+    const auto& other_type = foo::lookup_local_struct_from_other_tu();
+    ASSERT_EQ(local_type.get_type_name(), other_type.get_type_name());
+    ASSERT_NE(&local_type, &other_type);
+    ASSERT_NE(local_type.get_hash(), other_type.get_hash());
+    ASSERT_EQ(local_type.get_traits().size, sizeof(LocalStruct));
+    ASSERT_EQ(other_type.get_traits().size, sizeof(kstd::u8));
+    ASSERT_EQ(&local_type, &*KSTD_LOOKUP_TYPE(LocalStruct));
+    ASSERT_EQ(local_type.get_hash(), kstd::reflect::StaticTypeInfo<LocalStruct> {}.get_hash());
+
+    const auto& local_field = *KSTD_LOOKUP_FIELD_T(LocalStruct, value);
+    const auto& other_field = foo::lookup_local_struct_field_from_other_tu();
+    ASSERT_NE(&local_field, &other_field);
+    ASSERT_EQ(local_field.get_traits().size, sizeof(kstd::u64));
+    ASSERT_EQ(other_field.get_traits().size, sizeof(kstd::u8));
+    ASSERT_EQ(local_type.as_type<LocalStruct>().get_field(local_type.as_type<LocalStruct>().get_fields()[0]),
+              &local_field);
+}
@@ -0,0 +1,117 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr auto snapshot_build_id = "test_registry_snapshot";
+
+    auto make_registry(kstd::reflect::Registry& registry, const std::vector<std::string>& names) noexcept -> void {
+        using namespace kstd::reflect;
+        for(const auto& name : names) {
+            const RegistryKey key {ElementType::FIELD, "SnapshotStruct", name, "int"};
+            registry.insert(key, registry.create<TypeInfo<kstd::i32>>(name, name));
+        }
+    }
+
+    auto get_snapshot_path() noexcept -> std::string {
+        return testing::TempDir() + "kstd_reflect_test.snapshot";
+    }
+}// namespace
+
+TEST(kstd_reflect, test_registry_snapshot_round_trip) {
+    using namespace kstd::reflect;
+    const std::vector<std::string> names {"x", "y", "z"};
+    const auto fingerprint = make_snapshot_fingerprint(snapshot_build_id);
+    const auto path = get_snapshot_path();
+    {
+        StringPool pool;
+        Registry registry {pool};
+        make_registry(registry, names);
+        const auto result = save_snapshot(registry, fingerprint, path);
+        ASSERT_TRUE(result);
+        ASSERT_GT(*result, sizeof(SnapshotHeader));
+    }
+
+    const auto snapshot = RegistrySnapshot::open(path, fingerprint);
+    ASSERT_TRUE(snapshot);
+    ASSERT_EQ((*snapshot)->get_entry_count(), names.size());
+    ASSERT_EQ((*snapshot)->get_string_count(), names.size() + 2);
+
+    for(kstd::usize index = 0; index < (*snapshot)->get_entry_count(); ++index) {
+        const auto key = (*snapshot)->get_key(index);
+        ASSERT_EQ(key.element_type, ElementType::FIELD);
+        ASSERT_EQ(key.scope, "SnapshotStruct");
+        ASSERT_EQ(key.signature, "int");
+        ASSERT_EQ((*snapshot)->get_entry(index).hash, key.hash());
+    }
+
+    StringPool pool;
+    Registry registry {pool};
+    ASSERT_EQ((*snapshot)->adopt(registry), names.size() + 2);
+    ASSERT_EQ((*snapshot)->adopt(registry), 0);
+
+    // Keys inserted afterwards share the strings of the mapping
+    make_registry(registry, names);
+    ASSERT_EQ(pool.get_size(), names.size() + 2);
+    registry.for_each([&](const RegistryKey& key, const RTTI&, kstd::usize) {
+        ASSERT_EQ(key.scope.data(), pool.intern("SnapshotStruct").data());
+    });
+    std::remove(path.c_str());
+}
+
+TEST(kstd_reflect, test_registry_snapshot_rejects_invalid_files) {
+    using namespace kstd::reflect;
+    const auto fingerprint = make_snapshot_fingerprint(snapshot_build_id);
+    const auto path = get_snapshot_path();
+    ASSERT_FALSE(RegistrySnapshot::open(path + ".missing", fingerprint));
+
+    StringPool pool;
+    Registry registry {pool};
+    make_registry(registry, {"a", "b"});
+    ASSERT_TRUE(save_snapshot(registry, fingerprint, path));
+    ASSERT_FALSE(RegistrySnapshot::open(path, make_snapshot_fingerprint("other_build")));
+
+    // Truncate the snapshot in the middle of its string contents
+    auto buffer = write_snapshot(registry, fingerprint);
+    auto* file = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    std::fwrite(buffer.data(), 1, buffer.size() - 2, file);
+    std::fclose(file);
+    ASSERT_FALSE(RegistrySnapshot::open(path, fingerprint));
+
+    // Point the first entry at a string which does not exist
+    SnapshotHeader header {};
+    std::memcpy(&header, buffer.data(), sizeof(SnapshotHeader));
+    buffer[detail::get_snapshot_entries_offset(header.string_count) + offsetof(SnapshotEntry, name)] = 0xFF;
+    file = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    std::fwrite(buffer.data(), 1, buffer.size(), file);
+    std::fclose(file);
+    ASSERT_FALSE(RegistrySnapshot::open(path, fingerprint));
+    std::remove(path.c_str());
+}
@@ -0,0 +1,108 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace {
+    struct StatsStruct final {
+        kstd::i32 value;
+        kstd::f64 weight;
+    };
+
+    [[maybe_unused]] auto stats_function(kstd::i32 value) noexcept -> kstd::i32 {
+        return value;
+    }
+}// namespace
+
+TEST(kstd_reflect, test_registry_stats_elements) {
+    using namespace kstd::reflect;
+    (void) KSTD_LOOKUP_FIELD_T(StatsStruct, value);
+    (void) KSTD_LOOKUP_FUN(stats_function);
+    const auto stats = registry_stats();
+
+    ASSERT_GE(stats.get_elements(ElementType::TYPE).count, 1);
+    ASSERT_GE(stats.get_elements(ElementType::FIELD).count, 1);
+    ASSERT_GE(stats.get_elements(ElementType::FUNCTION).count, 1);
+    ASSERT_GE(stats.get_elements(ElementType::FIELD).byte_size,
+              stats.get_elements(ElementType::FIELD).count * sizeof(FieldInfo<StatsStruct, kstd::i32>));
+
+    kstd::usize entry_count = 0;
+    for(const auto& elements : stats.elements) {
+        entry_count += elements.count;
+    }
+    ASSERT_EQ(entry_count, stats.entry_count);
+    ASSERT_GT(stats.table_byte_size, 0);
+    ASSERT_GT(stats.arena_byte_size, 0);
+    ASSERT_GT(stats.string_count, 0);
+}
+
+TEST(kstd_reflect, test_registry_stats_iteration) {
+    using namespace kstd::reflect;
+    Registry registry;
+    const RegistryKey key {ElementType::TYPE, {}, "stats_type", {}};
+    const auto& value = registry.insert(key, registry.create<TypeInfo<kstd::i32>>("i", "int"));
+
+    kstd::usize count = 0;
+    registry.for_each([&](const RegistryKey& entry_key, const RTTI& entry_value, kstd::usize byte_size) {
+        ASSERT_EQ(entry_key, key);
+        ASSERT_EQ(&entry_value, &value);
+        ASSERT_GT(byte_size, sizeof(TypeInfo<kstd::i32>));
+        ++count;
+    });
+    ASSERT_EQ(count, 1);
+}
+
+TEST(kstd_reflect, test_registry_stats_counters) {
+    using namespace kstd::reflect;
+    const auto before = registry_stats();
+
+    // Fields are not cached in a per-type slot, so every lookup reaches the registry
+    std::vector<std::thread> threads;
+    for(kstd::usize index = 0; index < 4; ++index) {
+        threads.emplace_back([] {
+            for(kstd::usize iteration = 0; iteration < 100; ++iteration) {
+                (void) KSTD_LOOKUP_FIELD_T(StatsStruct, weight);
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto after = registry_stats();
+    const auto hits = after.get_counter(StatCounter::LOOKUP_HITS) - before.get_counter(StatCounter::LOOKUP_HITS);
+    const auto misses =
+            after.get_counter(StatCounter::LOOKUP_MISSES) - before.get_counter(StatCounter::LOOKUP_MISSES);
+
+    if constexpr(is_stats_enabled) {
+        ASSERT_EQ(hits + misses, 400);
+        ASSERT_GE(misses, 1);
+        ASSERT_GE(after.get_counter(StatCounter::TYPE_NAME_CALLS), misses);
+        ASSERT_GT(after.get_counter(StatCounter::KEY_ALLOCATIONS), 0);
+    }
+    else {
+        ASSERT_EQ(hits, 0);
+        ASSERT_EQ(misses, 0);
+    }
+}
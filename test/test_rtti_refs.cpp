@@ -56,4 +56,17 @@ TEST(kstd_reflect, test_rtti_ref_map) {
     ASSERT_EQ((types[*KSTD_LOOKUP_FIELD_T(foo::TestStruct, value1)]), "foobar");
     ASSERT_EQ((types[*KSTD_LOOKUP_FIELD_T(foo::TestStruct, value2)]), "hello");
     ASSERT_EQ((types[*KSTD_LOOKUP_FIELD_T(foo::TestStruct, value3)]), "world");
+}
+
+TEST(kstd_reflect, test_rtti_ref_hash) {
+    using namespace kstd::reflect;
+    const auto& info = *KSTD_LOOKUP_FIELD_T(foo::TestStruct, value1);
+    const auto& other_info = *KSTD_LOOKUP_FIELD_T(foo::TestStruct, value2);
+    const RegistryKey key {ElementType::FIELD, type_name_v<foo::TestStruct>, "value1",
+                           type_name_v<decltype(foo::TestStruct::value1)>};
+
+    ASSERT_NE(info.get_hash(), 0);
+    ASSERT_EQ(info.get_hash(), key.hash());
+    ASSERT_EQ(std::hash<RTTIRef> {}(info), info.get_hash());
+    ASSERT_NE(info.get_hash(), other_info.get_hash());
 }
\ No newline at end of file
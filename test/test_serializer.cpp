@@ -0,0 +1,178 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/serializer.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Message final {
+        kstd::u32 id;
+        kstd::u16 kind;
+        kstd::f64 value;
+        std::string text;
+        std::vector<kstd::i32> samples;
+        kstd::u64 checksum;
+    };
+
+    auto register_message() noexcept -> void {
+        (void) KSTD_REFLECT_STRUCT(Message, id, kind, value, text, samples, checksum);
+    }
+
+    struct Versioned final {
+        kstd::u32 id;
+        kstd::u32 revision;
+        kstd::u64 checksum;
+    };
+
+    struct Linked final {
+        kstd::u32 id;
+        Linked* next;
+    };
+
+    struct Referencing final {
+        kstd::u32 id;
+        std::vector<const kstd::u32*> targets;
+    };
+
+    struct Unregistered final {
+        kstd::u32 value;
+    };
+}// namespace
+
+TEST(kstd_reflect, test_serializer_round_trip) {
+    register_message();
+    const Message message {1, 2, 3.5, "a text which is longer than the small string buffer", {4, 5, 6}, 7};
+
+    std::vector<kstd::u8> buffer;
+    const auto written = kstd::reflect::serialize(message, buffer);
+    ASSERT_TRUE(written);
+    ASSERT_EQ(*written, buffer.size());
+    ASSERT_EQ(buffer.size() % kstd::reflect::serial_alignment, 0);
+
+    Message result {};
+    const auto read = kstd::reflect::deserialize(buffer.data(), buffer.size(), result);
+    ASSERT_TRUE(read);
+    ASSERT_EQ(*read, *written);
+    ASSERT_TRUE(*KSTD_LOOKUP_TYPE(Message)->equals(message, result));
+    ASSERT_EQ(result.text, message.text);
+    ASSERT_EQ(result.samples, message.samples);
+}
+
+TEST(kstd_reflect, test_serializer_multiple_records) {
+    register_message();
+    std::vector<kstd::u8> buffer;
+
+    for(kstd::u32 index = 0; index < 16; ++index) {
+        const Message message {index, 0, 0.0, std::string(index, 'x'), {}, index * 2U};
+        ASSERT_TRUE(kstd::reflect::serialize(message, buffer));
+    }
+
+    kstd::usize offset = 0;
+
+    for(kstd::u32 index = 0; index < 16; ++index) {
+        Message result {};
+        const auto read = kstd::reflect::deserialize(buffer.data() + offset, buffer.size() - offset, result);
+        ASSERT_TRUE(read);
+        ASSERT_EQ(result.id, index);
+        ASSERT_EQ(result.text.size(), index);
+        ASSERT_EQ(result.checksum, index * 2U);
+        offset += *read;
+    }
+
+    ASSERT_EQ(offset, buffer.size());
+}
+
+TEST(kstd_reflect, test_serializer_view) {
+    register_message();
+    const Message message {1, 2, 3.5, "viewed in place", {4, 5, 6}, 7};
+
+    std::vector<kstd::u8> buffer;
+    ASSERT_TRUE(kstd::reflect::serialize(message, buffer));
+
+    const auto view = kstd::reflect::SerialView<Message>::create(buffer.data(), buffer.size());
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view->get(*KSTD_LOOKUP_FIELD_T(Message, id)), 1U);
+    ASSERT_EQ(view->get(*KSTD_LOOKUP_FIELD_T(Message, value)), 3.5);
+    ASSERT_EQ(view->get(*KSTD_LOOKUP_FIELD_T(Message, checksum)), 7U);
+
+    const auto text = view->get(*KSTD_LOOKUP_FIELD_T(Message, text));
+    ASSERT_EQ(text, "viewed in place");
+    ASSERT_TRUE(text.data() >= reinterpret_cast<const char*>(buffer.data()));// NOLINT
+}
+
+TEST(kstd_reflect, test_serializer_rejects_invalid_records) {
+    register_message();
+    const Message message {1, 2, 3.5, "text", {4}, 7};
+
+    std::vector<kstd::u8> buffer;
+    ASSERT_TRUE(kstd::reflect::serialize(message, buffer));
+
+    Message result {};
+    ASSERT_FALSE(kstd::reflect::deserialize(buffer.data(), buffer.size() - 1, result));
+
+    auto corrupted = buffer;
+    corrupted[8] ^= 0xFFU;// Layout hash
+    ASSERT_FALSE(kstd::reflect::deserialize(corrupted.data(), corrupted.size(), result));
+
+    corrupted = buffer;
+    const auto text_offset = sizeof(kstd::reflect::SerialHeader) + offsetof(Message, text);
+    corrupted[text_offset + 8] = 0xFFU;// Blob size past the end of the record
+    ASSERT_FALSE(kstd::reflect::SerialView<Message>::create(corrupted.data(), corrupted.size()));
+
+    std::vector<kstd::u8> other;
+    ASSERT_FALSE(kstd::reflect::serialize(Unregistered {}, other));
+}
+TEST(kstd_reflect, test_serializer_ignores_later_lookups) {
+    ASSERT_TRUE(KSTD_REFLECT_STRUCT(Versioned, id, checksum));
+    const Versioned value {1, 2, 3};
+
+    std::vector<kstd::u8> buffer;
+    ASSERT_TRUE(kstd::reflect::serialize(value, buffer));
+
+    // Looking up another field extends the layout of the type, but not the declared one
+    const auto revision = KSTD_LOOKUP_FIELD_T(Versioned, revision);
+    ASSERT_TRUE(revision);
+    ASSERT_EQ(KSTD_LOOKUP_TYPE(Versioned)->get_layout().get_fields().size(), 3);
+
+    Versioned result {0, 5, 0};
+    ASSERT_TRUE(kstd::reflect::deserialize(buffer.data(), buffer.size(), result));
+    ASSERT_EQ(result.id, 1U);
+    ASSERT_EQ(result.revision, 5U);
+    ASSERT_EQ(result.checksum, 3U);
+
+    std::vector<kstd::u8> other;
+    ASSERT_TRUE(kstd::reflect::serialize(value, other));
+    ASSERT_EQ(other.size(), buffer.size());
+    ASSERT_EQ(std::memcmp(other.data(), buffer.data(), sizeof(kstd::reflect::SerialHeader)), 0);
+}
+
+TEST(kstd_reflect, test_serializer_rejects_pointers) {
+    ASSERT_TRUE(KSTD_REFLECT_STRUCT(Linked, id, next));
+    ASSERT_TRUE(KSTD_REFLECT_STRUCT(Referencing, id, targets));
+
+    std::vector<kstd::u8> buffer;
+    Linked linked {1, nullptr};
+    ASSERT_FALSE(kstd::reflect::serialize(linked, buffer));
+    ASSERT_FALSE(kstd::reflect::serialize(Referencing {2, {&linked.id}}, buffer));
+    ASSERT_TRUE(buffer.empty());
+}
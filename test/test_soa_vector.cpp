@@ -0,0 +1,118 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/soa_vector.hpp>
+#include <string>
+
+namespace {
+    struct Particle final {
+        kstd::f32 x;
+        kstd::f32 y;
+        kstd::f64 mass;
+        std::string name;
+        kstd::u32 unlisted;
+    };
+
+    KSTD_STATIC_REFLECT_STRUCT(Particle, x, y, mass, name)
+
+    struct Tagged final {
+        const kstd::u32 tag;
+        kstd::f32 value;
+    };
+
+    KSTD_STATIC_REFLECT_STRUCT(Tagged, tag, value)
+
+    auto make_particle(kstd::usize index) noexcept -> Particle {
+        const auto value = static_cast<kstd::f32>(index);
+        return {value, value * 2.0F, value * 0.5, "particle with a name longer than the small buffer", 42};
+    }
+}// namespace
+
+TEST(kstd_reflect, test_soa_vector_columns) {
+    kstd::reflect::SoAVector<Particle> particles;
+    ASSERT_EQ(particles.get_column_count(), 4);
+
+    for(kstd::usize index = 0; index < 100; ++index) {
+        particles.push_back(make_particle(index));
+    }
+
+    ASSERT_EQ(particles.get_size(), 100);
+    ASSERT_GE(particles.get_capacity(), 100);
+
+    const auto* x = particles.get_column<0>();
+    const auto* mass = particles.get_column<2>();
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(x) % kstd::reflect::soa_alignment, 0);   // NOLINT
+    ASSERT_EQ(reinterpret_cast<kstd::usize>(mass) % kstd::reflect::soa_alignment, 0);// NOLINT
+
+    for(kstd::usize index = 0; index < particles.get_size(); ++index) {
+        ASSERT_EQ(x[index], static_cast<kstd::f32>(index));
+        ASSERT_EQ(mass[index], static_cast<kstd::f64>(index) * 0.5);
+        ASSERT_EQ(particles.get_column<3>()[index], make_particle(index).name);
+    }
+}
+
+TEST(kstd_reflect, test_soa_vector_rows) {
+    kstd::reflect::SoAVector<Particle> particles(8);
+    ASSERT_EQ(particles.get_size(), 8);
+    ASSERT_EQ(particles[3].get<1>(), 0.0F);
+
+    particles[3].store(make_particle(3));
+    particles[5].get<0>() = 7.0F;
+
+    const auto particle = particles[3].load();
+    ASSERT_EQ(particle.y, 6.0F);
+    ASSERT_EQ(particle.name, make_particle(3).name);
+    ASSERT_EQ(particle.unlisted, 0);// Not part of the static field list
+    ASSERT_EQ(particles.load(5).x, 7.0F);
+
+    const auto& const_particles = particles;
+    ASSERT_EQ(const_particles[3].get<2>(), 1.5);
+
+    particles.pop_back();
+    particles.resize(4);
+    ASSERT_EQ(particles.get_size(), 4);
+    ASSERT_EQ(particles[3].load().name, make_particle(3).name);
+}
+
+TEST(kstd_reflect, test_soa_vector_move) {
+    kstd::reflect::SoAVector<Particle> particles;
+    particles.push_back(make_particle(1));
+
+    auto moved = std::move(particles);
+    ASSERT_EQ(moved.get_size(), 1);
+    ASSERT_EQ(moved[0].get<3>(), make_particle(1).name);
+    ASSERT_TRUE(particles.is_empty());// NOLINT
+    ASSERT_EQ(particles.get_column<0>(), nullptr);
+
+    particles = std::move(moved);
+    ASSERT_EQ(particles.load(0).mass, 0.5);
+    particles.clear();
+    ASSERT_TRUE(particles.is_empty());
+}
+
+TEST(kstd_reflect, test_soa_vector_const_fields) {
+    // Columns hold copies, so const fields can be stored, but not loaded back into an existing object
+    kstd::reflect::SoAVector<Tagged> tagged;
+    tagged.push_back({1, 2.0F});
+    tagged[0].store({3, 4.0F});
+    ASSERT_EQ(tagged[0].get<0>(), 3U);
+    ASSERT_EQ(tagged.get_column<1>()[0], 4.0F);
+}
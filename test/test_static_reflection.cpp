@@ -0,0 +1,130 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include "foo_types.hpp"
+
+namespace {
+    struct Vector final {
+        kstd::f32 x;
+        kstd::f32 y;
+        kstd::f32 z;
+    };
+
+    KSTD_STATIC_REFLECT_STRUCT(Vector, x, y, z)
+
+    struct Unlisted final {
+        kstd::u64 value;
+    };
+
+    constexpr auto sum_fields(const Vector& value) noexcept -> kstd::f32 {
+        kstd::f32 result = 0.0F;
+        kstd::reflect::static_type_info<Vector>.for_each_field([&](const auto& field) {
+            result += field.get(value);
+        });
+        return result;
+    }
+
+    constexpr auto make_vector() noexcept -> Vector {
+        Vector result {1.0F, 2.0F, 3.0F};
+        kstd::reflect::static_type_info<Vector>.get_field<2>().set(result, 4.0F);
+        return result;
+    }
+
+    constexpr auto add(kstd::i32 lhs, kstd::i32 rhs) noexcept -> kstd::i32 {
+        return lhs + rhs;
+    }
+}// namespace
+
+TEST(kstd_reflect, test_static_types) {
+    using namespace kstd::reflect;
+    constexpr auto& info = static_type_info<Vector>;
+
+    static_assert(info.get_size() == sizeof(Vector));
+    static_assert(info.get_alignment() == alignof(Vector));
+    static_assert(!info.is_primitive());
+    static_assert(static_type_info<kstd::f32>.is_primitive());
+    static_assert(info.get_type_name() == type_name_v<Vector>);
+    static_assert(static_type_info<Unlisted>.get_field_count() == 0);
+
+    // Runtime RTTI is derived from the static tier and agrees with it
+    const auto& runtime_info = *lookup(info);
+    ASSERT_EQ(&runtime_info, &*KSTD_LOOKUP_TYPE(Vector));
+    ASSERT_EQ(runtime_info.get_hash(), info.get_hash());
+    ASSERT_EQ(runtime_info.get_size(), info.get_size());
+}
+
+TEST(kstd_reflect, test_static_fields) {
+    using namespace kstd::reflect;
+    constexpr auto& info = static_type_info<Vector>;
+
+    static_assert(info.get_field_count() == 3);
+    static_assert(info.get_field<1>().name == "y");
+    static_assert(info.get_field<1>().offset == offsetof(Vector, y));
+    static_assert(std::is_same_v<std::decay_t<decltype(std::get<2>(static_field_list<Vector>))>::Type, kstd::f32>);
+    static_assert(sum_fields(Vector {1.0F, 2.0F, 3.0F}) == 6.0F);
+    static_assert(make_vector().z == 4.0F);
+
+    const auto& field = *lookup_field(info.get_field<1>());
+    ASSERT_EQ(field.get_name(), "y");
+    ASSERT_EQ(field.get_offset(), offsetof(Vector, y));
+    ASSERT_EQ(field.get_hash(), info.get_field<1>().get_hash());
+}
+
+TEST(kstd_reflect, test_static_reflect_struct) {
+    using namespace kstd::reflect;
+    const auto& type = *reflect_struct<Vector>();
+
+    ASSERT_EQ(type.get_fields().size(), 3);
+    ASSERT_EQ(type.get_fields()[0].name, "x");
+    ASSERT_EQ(type.get_fields()[2].offset, offsetof(Vector, z));
+}
+
+TEST(kstd_reflect, test_static_functions) {
+    using namespace kstd::reflect;
+    constexpr auto& info = static_function_info<&add>;
+
+    static_assert(info.get_param_count() == 2);
+    static_assert(info.is_noexcept());
+    static_assert(info.get_flags().is_noexcept);
+    static_assert(!info.is_member());
+    static_assert(info.get_element_type() == ElementType::FUNCTION);
+    static_assert(info.invoke(2, 3) == 5);
+    static_assert(std::is_same_v<StaticFunctionInfo<&add>::ReturnType, kstd::i32>);
+
+    constexpr auto& member_info = static_function_info<&foo::TestStruct::member_function>;
+    static_assert(member_info.is_member());
+    static_assert(member_info.is_const());
+    static_assert(!member_info.is_volatile());
+    static_assert(member_info.get_flags().is_const && !member_info.get_flags().is_lvalue_ref);
+    static_assert(member_info.get_param_count() == 2);
+    static_assert(member_info.get_param<1>().get_type_name() == type_name_v<kstd::i32&>);
+
+    foo::TestStruct instance;
+    kstd::i32 value = 0;
+    ASSERT_EQ(member_info.invoke(instance, nullptr, value), instance.member_function(nullptr, value));
+
+    const auto& runtime_info = *lookup_function(member_info, "foo::TestStruct::member_function");
+    ASSERT_EQ(&runtime_info, &*KSTD_LOOKUP_FUN_M(foo::TestStruct::member_function));
+    ASSERT_EQ(runtime_info.get_type_name(), member_info.get_type_name());
+    ASSERT_EQ(lookup_function(info, "add")->get_type_name(), info.get_type_name());
+    ASSERT_TRUE(lookup_function(info, "add")->get_flags().is_noexcept);
+}
@@ -0,0 +1,63 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include "foo_types.hpp"
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+
+TEST(kstd_reflect, test_string_pool_intern) {
+    kstd::reflect::StringPool pool;
+    const std::string first {"some_interned_name"};
+    const std::string second {"some_interned_name"};
+
+    const auto first_view = pool.intern(first);
+    const auto second_view = pool.intern(second);
+    ASSERT_EQ(first_view, "some_interned_name");
+    ASSERT_EQ(first_view.data(), second_view.data());
+    ASSERT_NE(first_view.data(), first.data());
+    ASSERT_EQ(pool.get_size(), 1);
+}
+
+TEST(kstd_reflect, test_string_pool_intern_static) {
+    kstd::reflect::StringPool pool;
+    static constexpr std::string_view name {"some_static_name"};
+
+    const auto view = pool.intern_static(name);
+    ASSERT_EQ(view.data(), name.data());
+    ASSERT_EQ(pool.intern(std::string {name}).data(), name.data());
+}
+
+TEST(kstd_reflect, test_string_pool_intern_substring) {
+    kstd::reflect::StringPool pool;
+
+    const auto qualified = pool.intern("foo::some_name");
+    const auto stripped = pool.intern_substring("foo::some_name", 5);
+    ASSERT_EQ(stripped, "some_name");
+    ASSERT_EQ(stripped.data(), qualified.data() + 5);
+    ASSERT_EQ(pool.intern("some_name").data(), stripped.data());
+}
+
+TEST(kstd_reflect, test_string_pool_element_names) {
+    const auto& first = *KSTD_LOOKUP_FIELD_T(foo::TestStruct, value1);
+    const auto& second = *KSTD_LOOKUP_FIELD_T(foo::TestStruct, value2);
+    ASSERT_EQ(first.get_name().data(), kstd::reflect::get_string_pool().intern("value1").data());
+    ASSERT_EQ(second.get_name().data(), kstd::reflect::get_string_pool().intern("value2").data());
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+
+#include <string>
+
+namespace hierarchy {
+    struct Shape {
+        kstd::i32 id {0};
+
+        virtual ~Shape() noexcept = default;
+        [[nodiscard]] virtual auto get_area() const noexcept -> kstd::f32 = 0;
+    };
+
+    struct Named {
+        std::string name;
+    };
+
+    struct Circle : Shape, Named {
+        kstd::f32 radius {1.0F};
+
+        [[nodiscard]] auto get_area() const noexcept -> kstd::f32 override {
+            return radius * radius * 3.14159F;
+        }
+    };
+
+    struct Ring final : Circle {
+        kstd::f32 inner_radius {0.5F};
+    };
+
+    struct Unrelated final {};
+
+    struct Root {
+        kstd::i32 value {0};
+    };
+
+    struct Left : Root {
+        kstd::i32 left {0};
+    };
+
+    struct Right : Root {
+        kstd::i32 right {0};
+    };
+
+    struct Diamond final : Left, Right {};
+
+    // Registers derived types before their bases on purpose
+    auto reflect_hierarchy() noexcept -> void {
+        const auto ring = KSTD_REFLECT_BASES(Ring, Circle);
+        const auto circle = KSTD_REFLECT_BASES(Circle, Shape, Named);
+        const auto diamond = KSTD_REFLECT_BASES(Diamond, Left, Right);
+        const auto left = KSTD_REFLECT_BASES(Left, Root);
+        const auto right = KSTD_REFLECT_BASES(Right, Root);
+        ASSERT_TRUE(ring && circle && diamond && left && right);
+    }
+}// namespace hierarchy
+
+TEST(kstd_reflect, test_type_hierarchy) {
+    using namespace hierarchy;
+    reflect_hierarchy();
+
+    const auto& ring = *KSTD_LOOKUP_TYPE(Ring);
+    const auto& bases = ring.get_hierarchy()->get_bases();
+    ASSERT_EQ(bases.size(), 1);
+    ASSERT_TRUE(bases[0].type->is_same(*KSTD_LOOKUP_TYPE(Circle)));
+    ASSERT_EQ(ring.get_hierarchy()->get_ancestors().size(), 3);
+    ASSERT_TRUE(ring.get_hierarchy()->is_perfect());
+
+    // Registering the same bases again has no effect
+    const auto circle = KSTD_REFLECT_BASES(Circle, Shape, Named);
+    ASSERT_TRUE(circle);
+    ASSERT_EQ(KSTD_LOOKUP_TYPE(Circle)->get_hierarchy()->get_bases().size(), 2);
+    ASSERT_EQ(KSTD_LOOKUP_TYPE(Unrelated)->get_hierarchy()->get_bases().size(), 0);
+    ASSERT_EQ(KSTD_LOOKUP_TYPE(kstd::i32)->get_hierarchy(), nullptr);
+}
+
+TEST(kstd_reflect, test_type_hierarchy_is_derived_from) {
+    using namespace hierarchy;
+    reflect_hierarchy();
+
+    const kstd::reflect::RTTI& ring = *KSTD_LOOKUP_TYPE(Ring);
+    const kstd::reflect::RTTI& shape = *KSTD_LOOKUP_TYPE(Shape);
+
+    ASSERT_TRUE(ring.is_derived_from(ring));
+    ASSERT_TRUE(ring.is_derived_from(*KSTD_LOOKUP_TYPE(Circle)));
+    ASSERT_TRUE(ring.is_derived_from(shape));
+    ASSERT_TRUE(ring.is_derived_from(*KSTD_LOOKUP_TYPE(Named)));
+    ASSERT_FALSE(shape.is_derived_from(ring));
+    ASSERT_FALSE(ring.is_derived_from(*KSTD_LOOKUP_TYPE(Unrelated)));
+    ASSERT_FALSE(ring.is_derived_from(*KSTD_LOOKUP_TYPE(kstd::i32)));
+    ASSERT_FALSE(KSTD_LOOKUP_TYPE(kstd::i32)->is_derived_from(shape));
+
+    // Ambiguous bases are still bases, they just cannot be cast to
+    const kstd::reflect::RTTI& diamond = *KSTD_LOOKUP_TYPE(Diamond);
+    ASSERT_TRUE(diamond.is_derived_from(*KSTD_LOOKUP_TYPE(Root)));
+    ASSERT_TRUE(diamond.get_hierarchy()->find(*KSTD_LOOKUP_TYPE(Root))->is_ambiguous);
+}
+
+TEST(kstd_reflect, test_type_hierarchy_cast) {
+    using namespace hierarchy;
+    reflect_hierarchy();
+
+    Ring value {};
+    const auto& ring = *KSTD_LOOKUP_TYPE(Ring);
+    Named* named = &value;
+    Shape* shape = &value;
+
+    // Up casts
+    ASSERT_EQ(kstd::reflect::cast<Named>(static_cast<void*>(&value), ring), named);
+    ASSERT_EQ(kstd::reflect::cast<Shape>(&value, ring), shape);
+    ASSERT_EQ(kstd::reflect::cast<Ring>(&value, ring), &value);
+
+    // Down and cross casts
+    ASSERT_EQ(kstd::reflect::cast<Ring>(named, ring), &value);
+    ASSERT_EQ(kstd::reflect::cast<Circle>(shape, ring), static_cast<Circle*>(&value));
+    ASSERT_EQ(kstd::reflect::cast<Shape>(named, ring), shape);
+
+    const Named* const_named = named;
+    const Ring* const_ring = kstd::reflect::cast<Ring>(const_named, ring);
+    ASSERT_EQ(const_ring, &value);
+
+    ASSERT_EQ(kstd::reflect::cast<Unrelated>(&value, ring), nullptr);
+    ASSERT_EQ(kstd::reflect::cast<Ring>(named, *KSTD_LOOKUP_TYPE(Circle)), nullptr);
+    ASSERT_EQ(kstd::reflect::cast<Ring>(static_cast<Named*>(nullptr), ring), nullptr);
+
+    Diamond diamond {};
+    const auto& diamond_type = *KSTD_LOOKUP_TYPE(Diamond);
+    ASSERT_EQ(kstd::reflect::cast<Root>(&diamond, diamond_type), nullptr);
+    ASSERT_EQ(kstd::reflect::cast<Right>(&diamond, diamond_type), static_cast<Right*>(&diamond));
+}
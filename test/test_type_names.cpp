@@ -0,0 +1,116 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 17/10/2026
+ */
+
+#include "foo_types.hpp"
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static_assert(kstd::reflect::type_name_v<int> == "int");
+static_assert(kstd::reflect::type_name_v<foo::TestStruct> == "foo::TestStruct");
+
+namespace names {
+    template<typename T>
+    struct Box final {};
+
+    template<typename K, typename V>
+    struct Pair final {};
+}// namespace names
+
+namespace {
+    struct AnonymousStruct final {};
+}// namespace
+
+/*
+ * Pretty names and demangled names are known to differ in three ways:
+ * - The pretty name leaves out defaulted template arguments, the demangler spells them out
+ * - Anonymous namespaces are spelled {anonymous} by GCC, the demangler uses (anonymous namespace)
+ * - The pretty name puts cv-qualifiers first (const int*), the demangler puts them last (int const*)
+ */
+
+template<typename T>
+static auto assert_names_match() -> void {
+    const auto demangled = kstd::reflect::detail::demangle_type_name<T>();
+    ASSERT_TRUE(demangled);
+    ASSERT_EQ(kstd::reflect::type_name_v<T>, *demangled);
+}
+
+// Replaces every spelling of an anonymous namespace with the one the demangler uses
+static auto normalize_anonymous_namespaces(std::string name) -> std::string {
+    constexpr std::string_view replacement = "(anonymous namespace)";
+    for(const auto marker : kstd::reflect::detail::anonymous_namespace_markers) {
+        for(auto index = name.find(marker); index != std::string::npos; index = name.find(marker, index)) {
+            name.replace(index, marker.size(), replacement);
+            index += replacement.size();
+        }
+    }
+    return name;
+}
+
+template<typename T>
+static auto assert_names_match_except_anonymous_namespaces() -> void {
+    const auto demangled = kstd::reflect::detail::demangle_type_name<T>();
+    ASSERT_TRUE(demangled);
+    ASSERT_EQ(normalize_anonymous_namespaces(std::string {kstd::reflect::type_name_v<T>}),
+              normalize_anonymous_namespaces(*demangled));
+}
+
+// Both names have to agree up to the first defaulted template argument, which only the demangled name contains
+template<typename T>
+static auto assert_names_match_except_defaults() -> void {
+    const auto demangled = kstd::reflect::detail::demangle_type_name<T>();
+    ASSERT_TRUE(demangled);
+    const auto name = kstd::reflect::type_name_v<T>;
+    const auto prefix = name.substr(0, name.find_last_not_of("> ") + 1);
+    ASSERT_LT(name.size(), demangled->size());
+    ASSERT_EQ(prefix, std::string_view {*demangled}.substr(0, prefix.size()));
+}
+
+TEST(kstd_reflect, test_type_names) {
+    assert_names_match<bool>();
+    assert_names_match<char>();
+    assert_names_match<kstd::i32>();
+    assert_names_match<kstd::u32>();
+    assert_names_match<kstd::f32>();
+    assert_names_match<kstd::f64>();
+    assert_names_match<foo::TestStruct>();
+    assert_names_match<kstd::reflect::ElementType>();
+    assert_names_match<names::Box<kstd::i32>>();
+    assert_names_match<names::Box<names::Box<foo::TestStruct>>>();
+    assert_names_match<names::Pair<kstd::i32, names::Box<char>>>();
+}
+
+TEST(kstd_reflect, test_type_names_with_known_differences) {
+    assert_names_match_except_anonymous_namespaces<AnonymousStruct>();
+    assert_names_match_except_anonymous_namespaces<names::Box<AnonymousStruct>>();
+    assert_names_match_except_defaults<std::string>();
+    assert_names_match_except_defaults<std::vector<kstd::i32>>();
+    assert_names_match_except_defaults<std::vector<std::vector<kstd::i32>>>();
+    assert_names_match_except_defaults<names::Box<std::vector<kstd::i32>>>();
+}
+
+TEST(kstd_reflect, test_type_names_in_type_info) {
+    const auto info = KSTD_LOOKUP_TYPE(foo::TestStruct);
+    ASSERT_TRUE(info);
+    ASSERT_EQ(info->get_type_name(), "foo::TestStruct");
+    ASSERT_EQ(info->get_mangled_type_name(), typeid(foo::TestStruct).name());
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+// Copyright 2026 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include "foo_types.hpp"
+#include <gtest/gtest.h>
+#include <kstd/reflect/reflection.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace {
+    enum class TestEnum : kstd::u16 {
+        FIRST,
+        SECOND
+    };
+
+    struct TestBase {
+        virtual ~TestBase() noexcept = default;
+        virtual auto get_value() const noexcept -> kstd::i32 = 0;
+    };
+
+    struct alignas(16) TestPod final {
+        kstd::u32 x;
+        kstd::f32 y;
+    };
+}// namespace
+
+TEST(kstd_reflect, test_type_traits_primitive) {
+    const kstd::reflect::RTTI& info = *KSTD_LOOKUP_TYPE(kstd::u32);
+    const auto& traits = info.get_traits();
+
+    ASSERT_EQ(traits.size, sizeof(kstd::u32));
+    ASSERT_EQ(traits.alignment, alignof(kstd::u32));
+    ASSERT_TRUE(traits.is_primitive);
+    ASSERT_TRUE(traits.is_integral);
+    ASSERT_FALSE(traits.is_floating_point);
+    ASSERT_FALSE(traits.is_class);
+    ASSERT_TRUE(traits.is_pod);
+    ASSERT_TRUE(traits.is_trivially_copyable);
+    ASSERT_TRUE(traits.is_trivially_destructible);
+    ASSERT_TRUE(KSTD_LOOKUP_TYPE(kstd::f64)->get_traits().is_floating_point);
+    ASSERT_TRUE(KSTD_LOOKUP_TYPE(bool)->get_traits().is_primitive);
+}
+
+TEST(kstd_reflect, test_type_traits_class) {
+    const kstd::reflect::RTTI& pod = *KSTD_LOOKUP_TYPE(TestPod);
+    ASSERT_EQ(pod.get_traits().size, sizeof(TestPod));
+    ASSERT_EQ(pod.get_traits().alignment, 16);
+    ASSERT_TRUE(pod.get_traits().is_class);
+    ASSERT_TRUE(pod.get_traits().is_pod);
+    ASSERT_TRUE(pod.get_traits().is_standard_layout);
+    ASSERT_FALSE(pod.get_traits().is_primitive);
+
+    const kstd::reflect::RTTI& string = *KSTD_LOOKUP_TYPE(std::string);
+    ASSERT_EQ(string.get_traits().size, sizeof(std::string));
+    ASSERT_FALSE(string.get_traits().is_trivially_copyable);
+    ASSERT_FALSE(string.get_traits().is_trivially_destructible);
+    ASSERT_TRUE(string.get_traits().is_default_constructible);
+    ASSERT_TRUE(string.get_traits().is_copy_constructible);
+    ASSERT_TRUE(string.get_traits().is_move_constructible);
+    ASSERT_TRUE(string.get_traits().is_destructible);
+
+    const kstd::reflect::RTTI& base = *KSTD_LOOKUP_TYPE(TestBase);
+    ASSERT_TRUE(base.get_traits().is_polymorphic);
+    ASSERT_TRUE(base.get_traits().is_abstract);
+    ASSERT_FALSE(base.get_traits().is_default_constructible);
+}
+
+TEST(kstd_reflect, test_type_traits_compound) {
+    const auto& enum_traits = KSTD_LOOKUP_TYPE(TestEnum)->get_traits();
+    ASSERT_TRUE(enum_traits.is_enum);
+    ASSERT_EQ(enum_traits.size, sizeof(kstd::u16));
+    ASSERT_FALSE(enum_traits.is_integral);
+
+    const auto& pointer_traits = KSTD_LOOKUP_TYPE(const char*)->get_traits();
+    ASSERT_TRUE(pointer_traits.is_pointer);
+    ASSERT_FALSE(pointer_traits.is_const);
+    ASSERT_TRUE(KSTD_LOOKUP_TYPE(const kstd::i32)->get_traits().is_const);
+
+    const auto& array_traits = KSTD_LOOKUP_TYPE(kstd::f32[4])->get_traits();
+    ASSERT_TRUE(array_traits.is_array);
+    ASSERT_EQ(array_traits.size, sizeof(kstd::f32) * 4);
+
+    // Types without storage report a size and alignment of 0
+    const auto& reference_traits = KSTD_LOOKUP_TYPE(kstd::i32&)->get_traits();
+    ASSERT_TRUE(reference_traits.is_reference);
+    ASSERT_EQ(reference_traits.size, 0);
+    ASSERT_FALSE(reference_traits.is_trivially_copyable);
+
+    const auto& void_traits = KSTD_LOOKUP_TYPE(void)->get_traits();
+    ASSERT_EQ(void_traits.size, 0);
+    ASSERT_EQ(void_traits.alignment, 0);
+    ASSERT_FALSE(void_traits.is_class);
+}
+
+TEST(kstd_reflect, test_type_traits_members) {
+    const kstd::reflect::RTTI& function = *KSTD_LOOKUP_FUN(foo::test_function);
+    ASSERT_TRUE(function.get_traits().is_function);
+    ASSERT_EQ(function.get_traits().size, 0);
+
+    // Fields report the traits of their type
+    const auto field = KSTD_LOOKUP_FIELD_T(TestPod, y);
+    ASSERT_TRUE(field);
+    ASSERT_TRUE(field->get_traits().is_floating_point);
+    ASSERT_EQ(field->get_traits().size, sizeof(kstd::f32));
+}
+
+TEST(kstd_reflect, test_type_traits_copy) {
+    // Generic copy which only knows the RTTI of its elements
+    const auto copy = [](const kstd::reflect::RTTI& info, void* destination, const void* source) {
+        if(!info.get_traits().is_trivially_copyable) {
+            return false;
+        }
+        std::memcpy(destination, source, info.get_traits().size);
+        return true;
+    };
+
+    const TestPod source {42, 1.5F};
+    TestPod destination {};
+    ASSERT_TRUE(copy(*KSTD_LOOKUP_TYPE(TestPod), &destination, &source));
+    ASSERT_EQ(destination.x, 42);
+    ASSERT_EQ(destination.y, 1.5F);
+
+    std::string string {};
+    ASSERT_FALSE(copy(*KSTD_LOOKUP_TYPE(std::string), &string, &string));
+}
@@ -26,4 +26,27 @@ TEST(kstd_reflect, test_types) {
     ASSERT_TRUE(info);
     ASSERT_EQ(info->get_element_type(), kstd::reflect::ElementType::TYPE);
     ASSERT_EQ(info->is_primitive(), false);
+}
+
+TEST(kstd_reflect, test_types_cached) {
+    const auto& first = *KSTD_LOOKUP_TYPE(foo::TestStruct);
+    const auto& second = *KSTD_LOOKUP_TYPE(foo::TestStruct);
+    ASSERT_EQ(&first, &second);
+    ASSERT_EQ(kstd::reflect::detail::type_slot<foo::TestStruct>.load(), &first);
+}
+
+TEST(kstd_reflect, test_types_same_across_registries) {
+    using namespace kstd::reflect;
+    const auto& global_info = *KSTD_LOOKUP_TYPE(foo::TestStruct);
+
+    // A second registry stands in for one owned by another shared library
+    Registry registry;
+    constexpr RegistryKey key {ElementType::TYPE, {}, type_name_v<foo::TestStruct>, {}};
+    const auto& local_info = registry.insert(
+            key, std::make_unique<TypeInfo<foo::TestStruct>>(global_info.get_mangled_type_name(),
+                                                            global_info.get_type_name()));
+
+    ASSERT_NE(&local_info, &global_info);
+    ASSERT_TRUE(local_info.is_same(global_info));
+    ASSERT_FALSE(local_info.is_same(*KSTD_LOOKUP_TYPE(kstd::i32)));
 }
\ No newline at end of file